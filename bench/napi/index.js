@@ -0,0 +1,23 @@
+const addon = require("./index.node");
+
+const groups = {
+  objects: addon.benchObjects,
+  strings: addon.benchStrings,
+  boxed: addon.benchBoxed,
+  channels: addon.benchChannels,
+  tasks: addon.benchTasks,
+};
+
+const filters = process.argv.slice(2);
+const selected = filters.length
+  ? Object.keys(groups).filter((name) => filters.includes(name))
+  : Object.keys(groups);
+
+if (!selected.length) {
+  console.error(`No matching groups; available: ${Object.keys(groups).join(", ")}`);
+  process.exit(1);
+}
+
+for (const name of selected) {
+  groups[name]();
+}
@@ -0,0 +1,25 @@
+use std::hint::black_box;
+
+use criterion::Criterion;
+use neon::prelude::*;
+
+pub fn boxed(mut cx: FunctionContext) -> JsResult<JsUndefined> {
+    let mut criterion = Criterion::default();
+    let mut group = criterion.benchmark_group("boxed");
+
+    let boxed = cx.boxed(42u64);
+
+    group.bench_function("new", |b| {
+        b.iter(|| {
+            cx.execute_scoped(|mut cx| {
+                black_box(cx.boxed(42u64));
+            })
+        })
+    });
+
+    group.bench_function("deref", |b| b.iter(|| black_box(**boxed)));
+
+    group.finish();
+
+    Ok(cx.undefined())
+}
@@ -0,0 +1,36 @@
+use std::hint::black_box;
+
+use criterion::Criterion;
+use neon::prelude::*;
+
+pub fn objects(mut cx: FunctionContext) -> JsResult<JsUndefined> {
+    let mut criterion = Criterion::default();
+    let mut group = criterion.benchmark_group("objects");
+
+    let object = cx.empty_object();
+    let value = cx.number(42);
+
+    object.set(&mut cx, "answer", value)?;
+
+    // Each iteration runs in its own handle scope so that handle creation
+    // stays bounded; the scope cost is part of a realistic crossing.
+    group.bench_function("get", |b| {
+        b.iter(|| {
+            cx.execute_scoped(|mut cx| {
+                black_box(object.get::<JsNumber, _, _>(&mut cx, "answer").unwrap());
+            })
+        })
+    });
+
+    group.bench_function("set", |b| {
+        b.iter(|| {
+            cx.execute_scoped(|mut cx| {
+                object.set(&mut cx, "answer", value).unwrap();
+            })
+        })
+    });
+
+    group.finish();
+
+    Ok(cx.undefined())
+}
@@ -0,0 +1,32 @@
+use std::hint::black_box;
+
+use criterion::Criterion;
+use neon::prelude::*;
+
+pub fn strings(mut cx: FunctionContext) -> JsResult<JsUndefined> {
+    let mut criterion = Criterion::default();
+    let mut group = criterion.benchmark_group("strings");
+
+    let short = cx.string("hello");
+    let long = cx.string("hello".repeat(200));
+
+    group.bench_function("new/short", |b| {
+        b.iter(|| {
+            cx.execute_scoped(|mut cx| {
+                black_box(cx.string("hello"));
+            })
+        })
+    });
+
+    group.bench_function("value/short", |b| {
+        b.iter(|| black_box(short.value(&mut cx)))
+    });
+
+    group.bench_function("value/long", |b| {
+        b.iter(|| black_box(long.value(&mut cx)))
+    });
+
+    group.finish();
+
+    Ok(cx.undefined())
+}
@@ -0,0 +1,21 @@
+use criterion::Criterion;
+use neon::prelude::*;
+
+pub fn tasks(mut cx: FunctionContext) -> JsResult<JsUndefined> {
+    let mut criterion = Criterion::default();
+    let mut group = criterion.benchmark_group("tasks");
+
+    // Measures the cost of dispatching a task to the libuv thread pool; the
+    // completions run on the event loop after the group finishes.
+    group.bench_function("dispatch", |b| {
+        b.iter(|| {
+            cx.execute_scoped(|mut cx| {
+                cx.task(|| ()).and_then(|_, ()| Ok(()));
+            })
+        })
+    });
+
+    group.finish();
+
+    Ok(cx.undefined())
+}
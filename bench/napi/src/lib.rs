@@ -0,0 +1,20 @@
+use neon::prelude::*;
+
+mod benches {
+    pub mod boxed;
+    pub mod channels;
+    pub mod objects;
+    pub mod strings;
+    pub mod tasks;
+}
+
+#[neon::main]
+fn main(mut cx: ModuleContext) -> NeonResult<()> {
+    cx.export_function("benchObjects", benches::objects::objects)?;
+    cx.export_function("benchStrings", benches::strings::strings)?;
+    cx.export_function("benchBoxed", benches::boxed::boxed)?;
+    cx.export_function("benchChannels", benches::channels::channels)?;
+    cx.export_function("benchTasks", benches::tasks::tasks)?;
+
+    Ok(())
+}
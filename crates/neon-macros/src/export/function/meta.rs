@@ -5,6 +5,8 @@ pub(crate) struct Meta {
     pub(super) json: bool,
     pub(super) context: bool,
     pub(super) this: bool,
+    pub(super) abort_unwind: bool,
+    pub(super) lazy: bool,
 }
 
 #[derive(Default)]
@@ -56,6 +58,27 @@ impl Meta {
 
         Ok(())
     }
+
+    fn make_lazy(&mut self, _meta: syn::meta::ParseNestedMeta) -> syn::Result<()> {
+        self.lazy = true;
+
+        Ok(())
+    }
+
+    fn set_unwind(&mut self, meta: syn::meta::ParseNestedMeta) -> syn::Result<()> {
+        let value = meta.value()?.parse::<syn::LitStr>()?;
+
+        if value.value() != "abort" {
+            return Err(syn::Error::new(
+                value.span(),
+                "expected `unwind = \"abort\"`",
+            ));
+        }
+
+        self.abort_unwind = true;
+
+        Ok(())
+    }
 }
 
 pub(crate) struct Parser(syn::ItemFn);
@@ -102,11 +125,26 @@ impl syn::parse::Parser for Parser {
                 return attr.make_task(meta);
             }
 
+            if meta.path.is_ident("lazy") {
+                return attr.make_lazy(meta);
+            }
+
+            if meta.path.is_ident("unwind") {
+                return attr.set_unwind(meta);
+            }
+
             Err(meta.error("unsupported property"))
         });
 
         parser.parse2(tokens)?;
 
+        if attr.abort_unwind && !matches!(attr.kind, Kind::Normal) {
+            return Err(syn::Error::new_spanned(
+                &item.sig.ident,
+                "`unwind = \"abort\"` is only supported on synchronous functions",
+            ));
+        }
+
         Ok((item, attr))
     }
 }
@@ -116,26 +116,64 @@ pub(super) fn export(meta: meta::Meta, input: syn::ItemFn) -> proc_macro::TokenS
             quote::quote!(#name)
         });
 
+    // Create the function without the `catch_unwind` panic boundary when the
+    // caller opts in to aborting the process on panic.
+    let create_call = if meta.abort_unwind {
+        quote::quote!(neon::macro_internal::create_function_abort_unwind(
+            cx,
+            NAME,
+            #wrapper_name,
+        ))
+    } else {
+        quote::quote!(neon::types::JsFunction::with_name(cx, NAME, #wrapper_name))
+    };
+
     // Generate the function that is registered to create the function on addon initialization.
     // Braces are included to prevent names from polluting user code.
     let create_name = quote::format_ident!("__NEON_EXPORT_CREATE__{name}");
-    let create_fn = quote::quote!({
-        #[doc(hidden)]
-        #[neon::macro_internal::linkme::distributed_slice(neon::macro_internal::EXPORTS)]
-        #[linkme(crate = neon::macro_internal::linkme)]
-        fn #create_name<'cx>(
-            cx: &mut neon::context::ModuleContext<'cx>,
-        ) -> neon::result::NeonResult<(&'static str, neon::handle::Handle<'cx, neon::types::JsValue>)> {
-            static NAME: &str = #export_name;
-
-            #wrapper_fn
-
-            neon::types::JsFunction::with_name(cx, NAME, #wrapper_name).map(|v| (
-                NAME,
-                neon::handle::Handle::upcast(&v),
-            ))
-        }
-    });
+    let create_fn = if meta.lazy {
+        // Lazy exports register a descriptor instead of a create function;
+        // the exported function is materialized on first property access.
+        quote::quote!({
+            #[doc(hidden)]
+            #[neon::macro_internal::linkme::distributed_slice(neon::macro_internal::LAZY_EXPORTS)]
+            #[linkme(crate = neon::macro_internal::linkme)]
+            static #create_name: neon::macro_internal::LazyExport = neon::macro_internal::LazyExport {
+                name: #export_name,
+                create: {
+                    fn create<'cx>(
+                        cx: &mut neon::context::Cx<'cx>,
+                    ) -> neon::result::JsResult<'cx, neon::types::JsValue> {
+                        static NAME: &str = #export_name;
+
+                        #wrapper_fn
+
+                        #create_call.map(|v| neon::handle::Handle::upcast(&v))
+                    }
+
+                    create
+                },
+            };
+        })
+    } else {
+        quote::quote!({
+            #[doc(hidden)]
+            #[neon::macro_internal::linkme::distributed_slice(neon::macro_internal::EXPORTS)]
+            #[linkme(crate = neon::macro_internal::linkme)]
+            fn #create_name<'cx>(
+                cx: &mut neon::context::ModuleContext<'cx>,
+            ) -> neon::result::NeonResult<(&'static str, neon::handle::Handle<'cx, neon::types::JsValue>)> {
+                static NAME: &str = #export_name;
+
+                #wrapper_fn
+
+                #create_call.map(|v| (
+                    NAME,
+                    neon::handle::Handle::upcast(&v),
+                ))
+            }
+        })
+    };
 
     // Output the original function with the generated `create_fn` inside of it
     quote::quote!(
@@ -31,8 +31,10 @@ pub(super) fn export(meta: meta::Meta, name: &syn::Ident, expr: Box<syn::Expr>)
         fn #create_name<'cx>(
             cx: &mut neon::context::ModuleContext<'cx>,
         ) -> neon::result::NeonResult<(&'static str, neon::handle::Handle<'cx, neon::types::JsValue>)> {
+            static NAME: &str = #export_name;
+
             neon::types::extract::TryIntoJs::try_into_js(#value, cx).map(|v| (
-                #export_name,
+                NAME,
                 neon::handle::Handle::upcast(&v),
             ))
         }
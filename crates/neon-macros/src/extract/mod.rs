@@ -0,0 +1,142 @@
+//! Derive implementations for the `TryFromJs` and `TryIntoJs` extraction traits.
+
+// `napi_define_properties` accepts an arbitrary number of descriptors, but the
+// batched `props().set_many(..)` builder is implemented for tuples of up to 32
+// pairs, so wider structs are written in chunks of 32.
+const MAX_BATCH: usize = 32;
+
+pub(crate) fn derive_try_from_js(item: proc_macro::TokenStream) -> proc_macro::TokenStream {
+    let item = syn::parse_macro_input!(item as syn::DeriveInput);
+
+    let fields = match named_fields(&item, "TryFromJs") {
+        Ok(fields) => fields,
+        Err(err) => return err.into_compile_error().into(),
+    };
+
+    let name = &item.ident;
+    let keys = keys_table(&fields);
+    let reads = fields.iter().enumerate().map(|(i, field)| {
+        let ident = &field.ident;
+
+        quote::quote!(
+            #ident: neon::object::Object::prop(&*obj, cx, &KEYS[#i]).get()?,
+        )
+    });
+
+    quote::quote!(
+        impl<'cx> neon::types::extract::TryFromJs<'cx> for #name {
+            type Error = neon::types::extract::TypeExpected<neon::types::JsObject>;
+
+            fn try_from_js(
+                cx: &mut neon::context::Cx<'cx>,
+                v: neon::handle::Handle<'cx, neon::types::JsValue>,
+            ) -> neon::result::NeonResult<Result<Self, Self::Error>> {
+                #keys
+
+                let obj = match v.downcast::<neon::types::JsObject, _>(cx) {
+                    Ok(obj) => obj,
+                    Err(_) => return Ok(Err(neon::macro_internal::type_expected())),
+                };
+
+                Ok(Ok(Self {
+                    #(#reads)*
+                }))
+            }
+        }
+    )
+    .into()
+}
+
+pub(crate) fn derive_try_into_js(item: proc_macro::TokenStream) -> proc_macro::TokenStream {
+    let item = syn::parse_macro_input!(item as syn::DeriveInput);
+
+    let fields = match named_fields(&item, "TryIntoJs") {
+        Ok(fields) => fields,
+        Err(err) => return err.into_compile_error().into(),
+    };
+
+    let name = &item.ident;
+    let keys = keys_table(&fields);
+
+    // One batched property-definition call per chunk of fields
+    let writes = fields.chunks(MAX_BATCH).map(|chunk| {
+        let pairs = chunk.iter().map(|field| {
+            let i = field.index;
+            let ident = &field.ident;
+
+            quote::quote!((&KEYS[#i], self.#ident),)
+        });
+
+        quote::quote!(
+            neon::object::Object::props(&*obj, cx).set_many((#(#pairs)*))?;
+        )
+    });
+
+    quote::quote!(
+        impl<'cx> neon::types::extract::TryIntoJs<'cx> for #name {
+            type Value = neon::types::JsObject;
+
+            fn try_into_js(
+                self,
+                cx: &mut neon::context::Cx<'cx>,
+            ) -> neon::result::JsResult<'cx, neon::types::JsObject> {
+                #keys
+
+                let obj = neon::context::Context::empty_object(cx);
+
+                #(#writes)*
+
+                Ok(obj)
+            }
+        }
+    )
+    .into()
+}
+
+struct Field {
+    index: usize,
+    ident: syn::Ident,
+    name: String,
+}
+
+// Extract the named fields of the struct being derived, preserving declaration order
+fn named_fields(item: &syn::DeriveInput, trait_name: &str) -> syn::Result<Vec<Field>> {
+    let fields = match &item.data {
+        syn::Data::Struct(syn::DataStruct {
+            fields: syn::Fields::Named(fields),
+            ..
+        }) => &fields.named,
+        _ => {
+            let span = syn::spanned::Spanned::span(&item);
+            let msg = format!("`{trait_name}` can only be derived for structs with named fields.");
+
+            return Err(syn::Error::new(span, msg));
+        }
+    };
+
+    Ok(fields
+        .iter()
+        .enumerate()
+        .map(|(index, field)| {
+            let ident = field.ident.clone().unwrap();
+            let name = ident.to_string();
+
+            Field { index, ident, name }
+        })
+        .collect())
+}
+
+// Generate a static table of interned property keys, one per field, so that
+// repeated conversions reuse the same key strings
+fn keys_table(fields: &[Field]) -> proc_macro2::TokenStream {
+    let len = fields.len();
+    let keys = fields.iter().map(|field| {
+        let name = &field.name;
+
+        quote::quote!(neon::object::Key::new(#name),)
+    });
+
+    quote::quote!(
+        static KEYS: [neon::object::Key; #len] = [#(#keys)*];
+    )
+}
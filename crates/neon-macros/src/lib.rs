@@ -1,6 +1,7 @@
 //! Procedural macros supporting [Neon](https://docs.rs/neon/latest/neon/)
 
 mod export;
+mod extract;
 
 #[proc_macro_attribute]
 pub fn main(
@@ -41,3 +42,18 @@ pub fn export(
 ) -> proc_macro::TokenStream {
     export::export(attr, item)
 }
+
+/// Derives `TryFromJs` for a struct with named fields, extracting each field
+/// from an object property of the same name. Property keys are interned, so
+/// repeated extractions do not re-create the key strings.
+#[proc_macro_derive(TryFromJs)]
+pub fn derive_try_from_js(item: proc_macro::TokenStream) -> proc_macro::TokenStream {
+    extract::derive_try_from_js(item)
+}
+
+/// Derives `TryIntoJs` for a struct with named fields, writing all of the
+/// fields to a new object with batched property-definition calls.
+#[proc_macro_derive(TryIntoJs)]
+pub fn derive_try_into_js(item: proc_macro::TokenStream) -> proc_macro::TokenStream {
+    extract::derive_try_into_js(item)
+}
@@ -222,6 +222,85 @@ pub type FinalizeContext<'cx> = Cx<'cx>;
 #[doc(hidden)]
 pub type SysContext<'cx> = Cx<'cx>;
 
+/// A handle arena created by [`Context::with_arena()`](Context::with_arena).
+///
+/// An arena owns a single memory management scope that stays open across
+/// many batches of work, with an explicit [`reset`](HandleArena::reset) to
+/// free all accumulated handles in bulk. This keeps the handle count of a
+/// long-running loop bounded without paying scope setup and teardown on
+/// every iteration, as repeated [`execute_scoped`](Context::execute_scoped)
+/// calls would.
+pub struct HandleArena<'cx> {
+    env: Env,
+    // `None` only transiently during `reset`
+    scope: Option<EscapableHandleScope>,
+    escaped: bool,
+    _phantom: PhantomData<&'cx ()>,
+}
+
+impl<'cx> HandleArena<'cx> {
+    fn new(env: Env) -> Self {
+        Self {
+            env,
+            scope: Some(unsafe { EscapableHandleScope::new(env.to_raw()) }),
+            escaped: false,
+            _phantom: PhantomData,
+        }
+    }
+
+    /// Executes one batch of work in the arena's current scope.
+    ///
+    /// Unlike [`execute_scoped`](Context::execute_scoped), no scope is
+    /// opened or closed per call; handles created by the batch stay alive
+    /// until the next [`reset`](HandleArena::reset).
+    pub fn execute<'b, T, F>(&'b mut self, f: F) -> T
+    where
+        F: FnOnce(Cx<'b>) -> T,
+    {
+        f(Cx::new(self.env))
+    }
+
+    /// Executes one batch of work and escapes its result value into the
+    /// outer context, so it survives both `reset` and the arena itself.
+    ///
+    /// # Panics
+    ///
+    /// A scope supports a single escape; calling this method twice without
+    /// an intervening [`reset`](HandleArena::reset) will panic.
+    pub fn compute<'b, V, F>(&'b mut self, f: F) -> JsResult<'cx, V>
+    where
+        V: Value,
+        F: FnOnce(Cx<'b>) -> JsResult<'b, V>,
+    {
+        if self.escaped {
+            panic!("attempt to escape twice from the same arena scope; call `reset` in between");
+        }
+
+        let result = f(Cx::new(self.env))?;
+
+        self.escaped = true;
+
+        let escapee = unsafe { self.scope.as_ref().unwrap().escape(result.to_local()) };
+
+        Ok(Handle::new_internal(unsafe {
+            V::from_local(self.env, escapee)
+        }))
+    }
+
+    /// Frees every handle created since the last reset.
+    ///
+    /// This costs two engine calls regardless of how many handles have
+    /// accumulated, so a loop can amortize it by resetting once per chunk
+    /// of iterations.
+    pub fn reset(&mut self) {
+        // Close the current scope before opening its replacement; scopes
+        // must be closed in the reverse order of opening
+        self.scope = None;
+        self.scope = Some(unsafe { EscapableHandleScope::new(self.env.to_raw()) });
+        self.escaped = false;
+    }
+}
+
 /// Context representing access to the JavaScript runtime
 pub struct Cx<'cx> {
     env: Env,
@@ -314,15 +393,6 @@ impl CallbackInfo<'_> {
         unsafe { sys::call::argv(cx.env().to_raw(), self.info) }
     }
 
-    pub fn this<'b, C: Context<'b>>(&self, cx: &mut C) -> raw::Local {
-        let env = cx.env();
-        unsafe {
-            let mut local: raw::Local = std::mem::zeroed();
-            sys::call::this(env.to_raw(), self.info, &mut local);
-            local
-        }
-    }
-
     pub(crate) fn argv_exact<'b, C: Context<'b>, const N: usize>(
         &self,
         cx: &mut C,
@@ -416,6 +486,47 @@ pub trait Context<'a>: ContextInternal<'a> {
         }))
     }
 
+    /// Executes a computation with a [`HandleArena`]: a single memory
+    /// management scope shared by many batches of work, with explicit bulk
+    /// [`reset`](HandleArena::reset) between them.
+    ///
+    /// This is the bulk counterpart to [`execute_scoped`](Context::execute_scoped)
+    /// and [`compute_scoped`](Context::compute_scoped) for loops where a
+    /// scope per iteration is too expensive but leaking every temporary
+    /// until return is unacceptable:
+    ///
+    /// ```
+    /// # use neon::prelude::*;
+    /// # fn iterate(mut cx: FunctionContext, rows: Vec<f64>) -> JsResult<JsUndefined> {
+    /// # let sink: Handle<JsFunction> = cx.argument(0)?;
+    /// cx.with_arena(|arena| -> NeonResult<()> {
+    ///     for chunk in rows.chunks(1024) {
+    ///         for row in chunk {
+    ///             arena.execute(|mut cx| {
+    ///                 let value = cx.number(*row);
+    ///                 sink.bind(&mut cx).arg(value)?.exec()
+    ///             })?;
+    ///         }
+    ///
+    ///         // Frees the chunk's temporaries with two engine calls
+    ///         arena.reset();
+    ///     }
+    ///
+    ///     Ok(())
+    /// })?;
+    /// # Ok(cx.undefined())
+    /// # }
+    /// ```
+    fn with_arena<'b, T, F>(&mut self, f: F) -> T
+    where
+        'a: 'b,
+        F: FnOnce(&mut HandleArena<'b>) -> T,
+    {
+        let mut arena = HandleArena::new(self.env());
+
+        f(&mut arena)
+    }
+
     fn try_catch<T, F>(&mut self, f: F) -> Result<T, Handle<'a, JsValue>>
     where
         F: FnOnce(&mut Self) -> NeonResult<T>,
@@ -643,6 +754,39 @@ pub trait Context<'a>: ContextInternal<'a> {
         TaskBuilder::new(self, execute)
     }
 
+    #[cfg(feature = "napi-4")]
+    #[cfg_attr(docsrs, doc(cfg(feature = "napi-4")))]
+    /// Creates a [`PoolTaskBuilder`](crate::event::PoolTaskBuilder) which
+    /// schedules the `execute` callback on a Neon-owned
+    /// [`TaskPool`](crate::event::TaskPool) instead of the Node worker pool.
+    ///
+    /// ```
+    /// # use neon::prelude::*;
+    /// # use neon::event::TaskPool;
+    /// fn greet(mut cx: FunctionContext) -> JsResult<JsPromise> {
+    ///     let pool = TaskPool::with_threads(2);
+    ///     let name = cx.argument::<JsString>(0)?.value(&mut cx);
+    ///
+    ///     let promise = cx
+    ///         .task_on(&pool, move || format!("Hello, {}!", name))
+    ///         .promise(move |mut cx, greeting| Ok(cx.string(greeting)));
+    ///
+    ///     Ok(promise)
+    /// }
+    /// ```
+    fn task_on<'cx, O, E>(
+        &'cx mut self,
+        pool: &crate::event::TaskPool,
+        execute: E,
+    ) -> crate::event::PoolTaskBuilder<'cx, Self, E>
+    where
+        'a: 'cx,
+        O: Send + 'static,
+        E: FnOnce() -> O + Send + 'static,
+    {
+        crate::event::PoolTaskBuilder::new(self, pool.clone(), execute)
+    }
+
     #[cfg(feature = "sys")]
     #[cfg_attr(docsrs, doc(cfg(feature = "sys")))]
     /// Gets the raw `sys::Env` for usage with Node-API.
@@ -781,7 +925,12 @@ impl<'cx> FunctionContext<'cx> {
 
     /// Indicates the number of arguments that were passed to the function.
     pub fn len(&self) -> usize {
-        self.info.len(self)
+        // Reuse the argument scratch if it has been fetched; otherwise ask
+        // for just the count without fetching the values
+        match self.arguments.as_ref() {
+            Some(argv) => argv.len(),
+            None => self.info.len(self),
+        }
     }
 
     /// Indicates if no arguments were passed to the function.
@@ -820,7 +969,17 @@ impl<'cx> FunctionContext<'cx> {
 
     /// Produces a handle to the function's [`this`-binding](https://developer.mozilla.org/en-US/docs/Web/JavaScript/Reference/Operators/this#function_context).
     pub fn this_value(&mut self) -> Handle<'cx, JsValue> {
-        JsValue::new_internal(self.info.this(self))
+        // The `this`-binding is fetched together with the arguments in a
+        // single `get_cb_info` call, so a function that reads both pays for
+        // one callback-info query rather than one per access
+        let argv = if let Some(argv) = self.arguments.as_ref() {
+            argv
+        } else {
+            let argv = self.info.argv(self);
+            self.arguments.insert(argv)
+        };
+
+        JsValue::new_internal(argv.this())
     }
 
     /// Extract Rust data from the JavaScript arguments.
@@ -122,6 +122,12 @@
 #[cfg(feature = "napi-4")]
 mod channel;
 
+#[cfg(feature = "napi-4")]
+mod pool;
+
+#[cfg(feature = "napi-4")]
+mod stream;
+
 mod task;
 
 pub use self::task::TaskBuilder;
@@ -129,7 +135,13 @@ pub use self::task::TaskBuilder;
 #[cfg(all(feature = "napi-5", feature = "futures"))]
 pub(crate) use self::channel::SendThrow;
 #[cfg(feature = "napi-4")]
-pub use self::channel::{Channel, JoinError, JoinHandle, SendError};
+pub use self::channel::{
+    BatchedChannel, BoundedChannel, Channel, JoinError, JoinHandle, SendError, TrySendError,
+};
+#[cfg(feature = "napi-4")]
+pub use self::pool::{PoolTaskBuilder, TaskPool, TaskPriority};
+#[cfg(feature = "napi-4")]
+pub use self::stream::{JsStream, StreamClosed};
 
 #[cfg(feature = "napi-4")]
 #[deprecated(since = "0.9.0", note = "Please use the Channel type instead")]
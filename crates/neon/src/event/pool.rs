@@ -0,0 +1,368 @@
+use std::{
+    cell::Cell,
+    collections::VecDeque,
+    fmt,
+    panic::{catch_unwind, resume_unwind, AssertUnwindSafe},
+    sync::{
+        atomic::{AtomicBool, Ordering},
+        Arc, Condvar, Mutex,
+    },
+    thread,
+};
+
+use crate::{
+    context::{Context, Cx},
+    handle::Handle,
+    result::{JsResult, NeonResult},
+    types::{JsPromise, Value},
+};
+
+/// Priority class of a task scheduled on a [`TaskPool`].
+///
+/// Within each worker, higher priority tasks are always dequeued before
+/// lower priority ones, so short latency-sensitive tasks are not stuck
+/// behind long-running batch work.
+#[derive(Copy, Clone, Debug, Default, Eq, PartialEq)]
+pub enum TaskPriority {
+    High,
+    #[default]
+    Normal,
+    Low,
+}
+
+const NUM_PRIORITIES: usize = 3;
+
+impl TaskPriority {
+    fn index(self) -> usize {
+        match self {
+            TaskPriority::High => 0,
+            TaskPriority::Normal => 1,
+            TaskPriority::Low => 2,
+        }
+    }
+}
+
+type Job = Box<dyn FnOnce() + Send + 'static>;
+
+/// A Neon-owned work-stealing thread pool, usable as an alternative backend
+/// to the Node worker pool for [`TaskBuilder`](crate::event::TaskBuilder)
+/// style tasks.
+///
+/// The Node worker pool is small, shared with Node's own file system and DNS
+/// work, and strictly FIFO; saturating it with long CPU-bound tasks starves
+/// the runtime and blocks short tasks behind long ones. A `TaskPool` runs a
+/// configurable number of dedicated threads with a deque per thread; idle
+/// workers steal from busy ones, and each task carries a [`TaskPriority`].
+///
+/// Schedule work on a pool with [`Context::task_on`](crate::context::Context::task_on):
+///
+/// ```
+/// # use neon::prelude::*;
+/// # use neon::event::{TaskPool, TaskPriority};
+/// # use once_cell::sync::Lazy;
+/// static POOL: Lazy<TaskPool> = Lazy::new(TaskPool::new);
+///
+/// fn compress(mut cx: FunctionContext) -> JsResult<JsPromise> {
+///     let data = cx.argument::<JsString>(0)?.value(&mut cx);
+///
+///     let promise = cx
+///         .task_on(&POOL, move || data.len())
+///         .priority(TaskPriority::Low)
+///         .promise(|mut cx, len| Ok(cx.number(len as f64)));
+///
+///     Ok(promise)
+/// }
+/// ```
+///
+/// Completion callbacks are delivered to the JavaScript thread through the
+/// instance's [`Channel`](crate::event::Channel), so promises settle exactly
+/// as they do for tasks on the Node worker pool. The pool's threads shut
+/// down when the last clone of the `TaskPool` is dropped, after running any
+/// tasks still queued.
+#[derive(Clone)]
+pub struct TaskPool {
+    handle: Arc<UserHandle>,
+}
+
+impl TaskPool {
+    /// Creates a pool with one worker per available CPU.
+    pub fn new() -> Self {
+        Self::with_threads(
+            thread::available_parallelism()
+                .map(usize::from)
+                .unwrap_or(4),
+        )
+    }
+
+    /// Creates a pool with the given number of worker threads.
+    pub fn with_threads(threads: usize) -> Self {
+        let threads = threads.max(1);
+        let shared = Arc::new(Shared {
+            injector: Mutex::new(Queues::default()),
+            workers: (0..threads)
+                .map(|_| Mutex::new(Queues::default()))
+                .collect(),
+            available: Condvar::new(),
+            shutdown: AtomicBool::new(false),
+        });
+
+        for index in 0..threads {
+            let shared = Arc::clone(&shared);
+
+            thread::spawn(move || Worker { shared, index }.run());
+        }
+
+        Self {
+            handle: Arc::new(UserHandle { shared }),
+        }
+    }
+
+    /// Number of worker threads in the pool.
+    pub fn threads(&self) -> usize {
+        self.handle.shared.workers.len()
+    }
+
+    pub(crate) fn spawn(&self, priority: TaskPriority, job: Job) {
+        let shared = &self.handle.shared;
+
+        // A task spawned from one of this pool's own workers goes to that
+        // worker's deque; external submissions go to the shared injector.
+        let local = CURRENT_WORKER
+            .with(Cell::get)
+            .and_then(|(pool, index)| (pool == Arc::as_ptr(shared).cast()).then_some(index));
+
+        match local {
+            Some(index) => shared.workers[index].lock().unwrap().push(priority, job),
+            None => shared.injector.lock().unwrap().push(priority, job),
+        }
+
+        // Taking the injector lock orders the notification after any
+        // sleeping worker's final check of the queues, so a wakeup cannot
+        // be lost.
+        let _guard = shared.injector.lock().unwrap();
+
+        shared.available.notify_one();
+    }
+}
+
+impl Default for TaskPool {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl fmt::Debug for TaskPool {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        f.debug_struct("TaskPool")
+            .field("threads", &self.threads())
+            .finish()
+    }
+}
+
+// Dropped when the last user clone of the pool goes away; the workers hold
+// `Arc<Shared>` directly, so shutdown is signalled explicitly.
+struct UserHandle {
+    shared: Arc<Shared>,
+}
+
+impl Drop for UserHandle {
+    fn drop(&mut self) {
+        self.shared.shutdown.store(true, Ordering::Release);
+
+        let _guard = self.shared.injector.lock().unwrap();
+
+        self.shared.available.notify_all();
+    }
+}
+
+struct Shared {
+    injector: Mutex<Queues>,
+    workers: Box<[Mutex<Queues>]>,
+    available: Condvar,
+    shutdown: AtomicBool,
+}
+
+// One FIFO queue per priority class
+#[derive(Default)]
+struct Queues([VecDeque<Job>; NUM_PRIORITIES]);
+
+impl Queues {
+    fn push(&mut self, priority: TaskPriority, job: Job) {
+        self.0[priority.index()].push_back(job);
+    }
+
+    // Dequeues in submission order, highest priority class first
+    fn pop(&mut self) -> Option<Job> {
+        self.0.iter_mut().find_map(VecDeque::pop_front)
+    }
+
+    // Steals the most recently submitted job of the highest non-empty
+    // priority class, leaving older jobs for the owning worker
+    fn steal(&mut self) -> Option<Job> {
+        self.0.iter_mut().find_map(VecDeque::pop_back)
+    }
+
+    fn is_empty(&self) -> bool {
+        self.0.iter().all(VecDeque::is_empty)
+    }
+}
+
+thread_local! {
+    // Identifies the pool and worker index of the current thread, if it is a
+    // `TaskPool` worker; used to route nested spawns to the local deque
+    static CURRENT_WORKER: Cell<Option<(*const (), usize)>> = const { Cell::new(None) };
+}
+
+struct Worker {
+    shared: Arc<Shared>,
+    index: usize,
+}
+
+impl Worker {
+    fn run(self) {
+        CURRENT_WORKER
+            .with(|current| current.set(Some((Arc::as_ptr(&self.shared).cast(), self.index))));
+
+        loop {
+            while let Some(job) = self.find_work() {
+                job();
+            }
+
+            let guard = self.shared.injector.lock().unwrap();
+
+            // Re-check under the lock: a job pushed after `find_work` came
+            // up empty notifies while holding this lock, so either we see
+            // the work here or the notification reaches our wait below
+            if !guard.is_empty() || self.peers_have_work() {
+                continue;
+            }
+
+            if self.shared.shutdown.load(Ordering::Acquire) {
+                return;
+            }
+
+            let _guard = self.shared.available.wait(guard).unwrap();
+        }
+    }
+
+    fn find_work(&self) -> Option<Job> {
+        if let Some(job) = self.shared.workers[self.index].lock().unwrap().pop() {
+            return Some(job);
+        }
+
+        if let Some(job) = self.shared.injector.lock().unwrap().pop() {
+            return Some(job);
+        }
+
+        // Steal from siblings, starting after this worker so contention
+        // spreads instead of converging on worker zero
+        let n = self.shared.workers.len();
+
+        for offset in 1..n {
+            let peer = &self.shared.workers[(self.index + offset) % n];
+
+            if let Some(job) = peer.lock().unwrap().steal() {
+                return Some(job);
+            }
+        }
+
+        None
+    }
+
+    fn peers_have_work(&self) -> bool {
+        self.shared
+            .workers
+            .iter()
+            .any(|queues| !queues.lock().unwrap().is_empty())
+    }
+}
+
+/// A builder for scheduling a task on a [`TaskPool`].
+///
+/// Created by [`Context::task_on`](crate::context::Context::task_on); the
+/// completion API mirrors [`TaskBuilder`](crate::event::TaskBuilder).
+pub struct PoolTaskBuilder<'cx, C, E> {
+    cx: &'cx mut C,
+    pool: TaskPool,
+    priority: TaskPriority,
+    execute: E,
+}
+
+impl<'a: 'cx, 'cx, C, O, E> PoolTaskBuilder<'cx, C, E>
+where
+    C: Context<'a>,
+    O: Send + 'static,
+    E: FnOnce() -> O + Send + 'static,
+{
+    pub(crate) fn new(cx: &'cx mut C, pool: TaskPool, execute: E) -> Self {
+        Self {
+            cx,
+            pool,
+            priority: TaskPriority::default(),
+            execute,
+        }
+    }
+
+    /// Sets the priority class of the task. Defaults to
+    /// [`TaskPriority::Normal`].
+    pub fn priority(mut self, priority: TaskPriority) -> Self {
+        self.priority = priority;
+        self
+    }
+
+    /// Schedules the task on the pool, executing the `complete` callback on
+    /// the JavaScript main thread with the result of the `execute` callback.
+    pub fn and_then<F>(self, complete: F)
+    where
+        F: FnOnce(Cx, O) -> NeonResult<()> + Send + 'static,
+    {
+        let channel = self.cx.channel();
+        let execute = self.execute;
+
+        self.pool.spawn(
+            self.priority,
+            Box::new(move || {
+                let output = catch_unwind(AssertUnwindSafe(execute));
+
+                let _ = channel.send(move |cx| {
+                    // A panic on a pool thread resumes on the JavaScript
+                    // thread, matching tasks on the Node worker pool
+                    let output = output.unwrap_or_else(|panic| resume_unwind(panic));
+
+                    complete(cx, output)
+                });
+            }),
+        );
+    }
+
+    /// Schedules the task on the pool and returns a promise that is settled
+    /// with the value from the `complete` callback.
+    ///
+    /// The `complete` callback will execute on the JavaScript main thread
+    /// and is passed the return value from `execute`. If the `complete`
+    /// callback throws, the promise is rejected with the exception.
+    pub fn promise<V, F>(self, complete: F) -> Handle<'a, JsPromise>
+    where
+        V: Value,
+        F: FnOnce(Cx, O) -> JsResult<V> + Send + 'static,
+    {
+        let channel = self.cx.channel();
+        let (deferred, promise) = JsPromise::new(self.cx);
+        let execute = self.execute;
+
+        self.pool.spawn(
+            self.priority,
+            Box::new(move || {
+                let output = catch_unwind(AssertUnwindSafe(execute));
+
+                deferred.settle_with(&channel, move |cx| {
+                    let output = output.unwrap_or_else(|panic| resume_unwind(panic));
+
+                    complete(cx, output)
+                });
+            }),
+        );
+
+        promise
+    }
+}
@@ -0,0 +1,231 @@
+use std::{
+    mem,
+    sync::{
+        atomic::{AtomicBool, AtomicU8, Ordering},
+        Arc, Mutex,
+    },
+    task::{self, Poll, Wake, Waker},
+    thread::{self, ThreadId},
+};
+
+use crate::{context::Context, sys::tsfn::ThreadsafeFunction};
+
+use super::{BoxFuture, Runtime};
+
+/// An executor that polls futures directly on the Node event loop thread.
+///
+/// The default tokio runtime polls futures on its own worker threads, so
+/// every completion that needs to touch JavaScript must be sent back to the
+/// event loop through a [`Channel`](crate::event::Channel). With a
+/// `LocalExecutor`, futures spawned by [`#[neon::export]`](crate::export)
+/// async functions are polled on the event loop itself; a continuation whose
+/// wakeup happens on the loop (for example, a settled
+/// [`JsFuture`](crate::types::JsFuture)) resumes without a cross-thread hop.
+///
+/// Polling on the event loop means a future that blocks or computes for a
+/// long time between `.await` points will stall JavaScript; offload heavy
+/// work with [`Channel`](crate::event::Channel) or a task before `.await`ing
+/// it.
+///
+/// # Example
+///
+/// ```
+/// # fn main() {
+/// # #[cfg(feature = "futures")]
+/// # fn example() {
+/// # use neon::prelude::*;
+/// use neon::LocalExecutor;
+///
+/// #[neon::main]
+/// fn main(mut cx: ModuleContext) -> NeonResult<()> {
+///     let executor = LocalExecutor::new(&mut cx);
+///     let _ = neon::set_global_executor(&mut cx, executor);
+///
+///     Ok(())
+/// }
+/// # }
+/// # }
+/// ```
+pub struct LocalExecutor {
+    shared: Arc<Shared>,
+}
+
+impl LocalExecutor {
+    /// Constructs an executor that polls its futures on the event loop of the
+    /// current instance of the addon.
+    pub fn new<'a, C: Context<'a>>(cx: &mut C) -> Self {
+        let env = cx.env();
+        let shared = Arc::new(Shared {
+            tsfn: once_cell::sync::OnceCell::new(),
+            queue: Mutex::new(Vec::new()),
+            scheduled: AtomicBool::new(false),
+            loop_thread: thread::current().id(),
+        });
+
+        // Unrefed so that pending futures do not prevent the event loop from
+        // exiting; tasks in flight at exit are dropped, not completed
+        let tsfn = unsafe {
+            let tsfn = ThreadsafeFunction::new(env.to_raw(), Shared::drain);
+            tsfn.unref(env.to_raw());
+            tsfn
+        };
+
+        // The `OnceCell` only breaks the chicken-and-egg problem between the
+        // shared state and the callback it hands to the threadsafe function
+        let _ = shared.tsfn.set(tsfn);
+
+        Self { shared }
+    }
+}
+
+impl Runtime for LocalExecutor {
+    fn spawn(&self, fut: BoxFuture) {
+        let task = Arc::new(Task {
+            state: AtomicU8::new(Task::IDLE),
+            future: Mutex::new(Some(fut)),
+            shared: Arc::clone(&self.shared),
+        });
+
+        task.wake_by_ref();
+    }
+}
+
+// State shared between the executor handle, its tasks and the event loop
+struct Shared {
+    tsfn: once_cell::sync::OnceCell<ThreadsafeFunction<Arc<Shared>>>,
+    queue: Mutex<Vec<Arc<Task>>>,
+    scheduled: AtomicBool,
+    // The thread the executor was created on, i.e. the event loop thread
+    loop_thread: ThreadId,
+}
+
+impl Shared {
+    // Enqueue a task to be polled on the event loop. Wakeups are batched; the
+    // threadsafe function is only signaled on the first task of a batch.
+    fn schedule(self: &Arc<Self>, task: Arc<Task>) {
+        // A wakeup that already happens on the event loop thread (for
+        // example, a `JsFuture` settled by a promise reaction) polls the
+        // task inline; the round trip through the threadsafe function is
+        // only needed to reach the loop from another thread. A wakeup
+        // arriving while the task is being polled takes the `RESCHEDULED`
+        // path in `wake_by_ref` instead, so the poll below never re-enters
+        // a poll of the same task.
+        if thread::current().id() == self.loop_thread {
+            task.poll();
+            return;
+        }
+
+        self.queue.lock().unwrap().push(task);
+
+        if !self.scheduled.swap(true, Ordering::AcqRel) {
+            let _ = self.tsfn.get().unwrap().call(Arc::clone(self), None);
+        }
+    }
+
+    // Executed on the event loop; polls every task scheduled so far. The
+    // `scheduled` flag is cleared before draining so that wakeups arriving
+    // during a poll schedule the next drain instead of being lost.
+    fn drain(_env: Option<crate::sys::raw::Env>, shared: Arc<Shared>) {
+        shared.scheduled.store(false, Ordering::Release);
+
+        let tasks = mem::take(&mut *shared.queue.lock().unwrap());
+
+        for task in tasks {
+            task.poll();
+        }
+    }
+}
+
+// A spawned future and its scheduling state
+struct Task {
+    state: AtomicU8,
+    future: Mutex<Option<BoxFuture>>,
+    shared: Arc<Shared>,
+}
+
+impl Task {
+    // No wakeup pending; the future is parked in `future`
+    const IDLE: u8 = 0;
+    // In the executor queue awaiting a poll
+    const SCHEDULED: u8 = 1;
+    // Being polled on the event loop
+    const RUNNING: u8 = 2;
+    // Woken while being polled; poll again before parking
+    const RESCHEDULED: u8 = 3;
+
+    // Polls the future on the event loop until it parks or completes
+    fn poll(self: &Arc<Self>) {
+        // The lock is uncontended: polling only happens on the event loop,
+        // and wakers never touch the future itself
+        let mut slot = self.future.lock().unwrap();
+
+        let Some(mut fut) = slot.take() else {
+            // Already completed; a straggling wakeup scheduled us
+            self.state.store(Self::IDLE, Ordering::Release);
+            return;
+        };
+
+        let waker = Waker::from(Arc::clone(self));
+        let mut cx = task::Context::from_waker(&waker);
+
+        loop {
+            self.state.store(Self::RUNNING, Ordering::Release);
+
+            match fut.as_mut().poll(&mut cx) {
+                Poll::Ready(()) => {
+                    self.state.store(Self::IDLE, Ordering::Release);
+                    return;
+                }
+                Poll::Pending => {
+                    match self.state.compare_exchange(
+                        Self::RUNNING,
+                        Self::IDLE,
+                        Ordering::AcqRel,
+                        Ordering::Acquire,
+                    ) {
+                        // Parked; the next wakeup reschedules the task
+                        Ok(_) => {
+                            *slot = Some(fut);
+                            return;
+                        }
+                        // A wakeup raced the poll; poll again so it is not lost
+                        Err(_) => continue,
+                    }
+                }
+            }
+        }
+    }
+}
+
+impl Wake for Task {
+    fn wake(self: Arc<Self>) {
+        self.wake_by_ref();
+    }
+
+    fn wake_by_ref(self: &Arc<Self>) {
+        let mut state = self.state.load(Ordering::Acquire);
+
+        loop {
+            let next = match state {
+                Self::IDLE => Self::SCHEDULED,
+                Self::RUNNING => Self::RESCHEDULED,
+                // Already scheduled; nothing to do
+                _ => return,
+            };
+
+            match self
+                .state
+                .compare_exchange_weak(state, next, Ordering::AcqRel, Ordering::Acquire)
+            {
+                Ok(_) => {
+                    if next == Self::SCHEDULED {
+                        self.shared.schedule(Arc::clone(self));
+                    }
+
+                    return;
+                }
+                Err(actual) => state = actual,
+            }
+        }
+    }
+}
@@ -2,9 +2,12 @@ use std::{future::Future, pin::Pin};
 
 use crate::{context::Cx, thread::LocalKey};
 
+pub(crate) mod local;
 #[cfg(feature = "tokio-rt")]
 pub(crate) mod tokio;
 
+pub use local::LocalExecutor;
+
 type BoxFuture = Pin<Box<dyn Future<Output = ()> + Send + 'static>>;
 
 pub(crate) static RUNTIME: LocalKey<Box<dyn Runtime>> = LocalKey::new();
@@ -10,10 +10,7 @@ use crate::{
 
 #[cfg(feature = "napi-6")]
 use {
-    crate::{
-        lifecycle::{DropData, InstanceData, InstanceId},
-        sys::tsfn::ThreadsafeFunction,
-    },
+    crate::lifecycle::{DropData, DropQueue, InstanceData, InstanceId},
     std::sync::Arc,
 };
 
@@ -55,7 +52,7 @@ pub struct Root<T> {
     internal: Option<NapiRef>,
     instance_id: InstanceId,
     #[cfg(feature = "napi-6")]
-    drop_queue: Arc<ThreadsafeFunction<DropData>>,
+    drop_queue: Arc<DropQueue>,
     _phantom: PhantomData<T>,
 }
 
@@ -230,7 +227,10 @@ impl<T> Drop for Root<T> {
     fn drop(&mut self) {
         // If `None`, the `NapiRef` has already been manually dropped
         if let Some(internal) = self.internal.take() {
-            let _ = self.drop_queue.call(DropData::Ref(internal), None);
+            self.drop_queue.push(DropData::Ref(internal));
+
+            #[cfg(feature = "stats")]
+            crate::meta::counters::root_drop_queued();
         }
     }
 }
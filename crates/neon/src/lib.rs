@@ -104,7 +104,7 @@ pub mod sys;
 
 #[cfg(all(feature = "napi-6", feature = "futures"))]
 #[cfg_attr(docsrs, doc(cfg(all(feature = "napi-6", feature = "futures"))))]
-pub use executor::set_global_executor;
+pub use executor::{set_global_executor, LocalExecutor, Runtime};
 pub use types_docs::exports as types;
 
 #[doc(hidden)]
@@ -178,13 +178,58 @@ impl Exports {
     /// # }
     /// ```
     pub fn export(self, cx: &mut ModuleContext) -> NeonResult<()> {
+        use crate::{
+            context::{internal::ContextInternal, Context},
+            result::Throw,
+            types::private::ValueInternal,
+        };
+
+        // Accumulate all exports into property descriptors and commit them
+        // with a single `napi_define_properties` call. Registering exports
+        // one property at a time is a measurable part of module load time
+        // for addons with many exports. The names are `'static` strings
+        // emitted by the `#[neon::export]` macros, so no per-export
+        // allocation happens on the Rust side.
+        let mut descriptors = Vec::with_capacity(crate::macro_internal::EXPORTS.len());
+
         for create in self {
             let (name, value) = create(cx)?;
+            let key = cx.string(name);
+
+            descriptors.push(crate::object::props::descriptor(
+                key.to_local(),
+                value.to_local(),
+            ));
+        }
+
+        // Lazy exports are registered as accessors; their getters create the
+        // exported function on first access.
+        for entry in crate::macro_internal::LAZY_EXPORTS {
+            let key = cx.string(entry.name);
 
-            cx.export_value(name, value)?;
+            descriptors.push(crate::macro_internal::lazy_descriptor(
+                key.to_local(),
+                entry,
+            ));
         }
 
-        Ok(())
+        if descriptors.is_empty() {
+            return Ok(());
+        }
+
+        let exports = cx.exports_object()?;
+
+        unsafe {
+            match crate::sys::object::define_properties(
+                cx.env().to_raw(),
+                exports.to_local(),
+                &descriptors,
+            ) {
+                Ok(()) => Ok(()),
+                Err(crate::sys::Status::PendingException) => Err(Throw::new()),
+                _ => cx.throw_type_error("failed to define module exports"),
+            }
+        }
     }
 }
 
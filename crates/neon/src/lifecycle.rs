@@ -10,10 +10,12 @@
 
 use std::{
     any::Any,
+    cell::Cell,
     marker::PhantomData,
+    mem, ptr,
     sync::{
-        atomic::{AtomicU32, Ordering},
-        Arc,
+        atomic::{AtomicBool, AtomicU32, Ordering},
+        Arc, Mutex,
     },
 };
 
@@ -53,12 +55,12 @@ pub(crate) struct InstanceData {
 
     /// Used to free `Root` in the same JavaScript environment that created it
     ///
-    /// _Design Note_: An `Arc` ensures the `ThreadsafeFunction` outlives the unloading
+    /// _Design Note_: An `Arc` ensures the [`DropQueue`] outlives the unloading
     /// of a module. Since it is unlikely that modules will be re-loaded frequently, this
-    /// could be replaced with a leaked `&'static ThreadsafeFunction<NapiRef>`. However,
+    /// could be replaced with a leaked `&'static DropQueue`. However,
     /// given the cost of FFI, this optimization is omitted until the cost of an
     /// `Arc` is demonstrated as significant.
-    drop_queue: Arc<ThreadsafeFunction<DropData>>,
+    drop_queue: Arc<DropQueue>,
 
     /// Shared `Channel` that is cloned to be returned by the `cx.channel()` method
     shared_channel: Channel,
@@ -222,6 +224,11 @@ pub(crate) enum DropData {
 impl DropData {
     /// Drop a value on the main thread
     fn drop(env: Option<Env>, data: Self) {
+        #[cfg(feature = "stats")]
+        if let DropData::Ref(_) = &data {
+            crate::meta::counters::root_drop_completed();
+        }
+
         if let Some(env) = env {
             unsafe {
                 match data {
@@ -233,6 +240,83 @@ impl DropData {
     }
 }
 
+/// Intake queue that coalesces values dropped off the JavaScript thread into
+/// a single threadsafe-function invocation per event-loop tick, instead of one
+/// crossing (and potential wakeup) per dropped value.
+pub(crate) struct DropQueue {
+    tsfn: ThreadsafeFunction<Arc<DropBatch>>,
+    batch: Arc<DropBatch>,
+}
+
+#[derive(Default)]
+struct DropBatch {
+    queue: Mutex<Vec<DropData>>,
+    scheduled: AtomicBool,
+}
+
+impl DropQueue {
+    /// Safety: `env` must be valid for the current thread
+    unsafe fn new(env: Env) -> Self {
+        let tsfn = ThreadsafeFunction::new(env, Self::drain);
+
+        tsfn.unref(env);
+
+        DropQueue {
+            tsfn,
+            batch: Arc::new(DropBatch::default()),
+        }
+    }
+
+    /// Enqueues a value to be dropped on the JavaScript thread, scheduling a
+    /// drain if one is not already pending
+    pub(crate) fn push(&self, data: DropData) {
+        self.batch.queue.lock().unwrap().push(data);
+
+        // Only the transition from `false` schedules a drain; since `drain`
+        // clears the flag before emptying the queue, no push can be lost. If
+        // the threadsafe function is closing (environment shutdown), pending
+        // values are leaked, exactly as individual calls were before.
+        if !self.batch.scheduled.swap(true, Ordering::AcqRel) {
+            let _ = self.tsfn.call(Arc::clone(&self.batch), None);
+        }
+    }
+
+    fn drain(env: Option<Env>, batch: Arc<DropBatch>) {
+        batch.scheduled.store(false, Ordering::Release);
+
+        let pending = mem::take(&mut *batch.queue.lock().unwrap());
+
+        for data in pending {
+            DropData::drop(env, data);
+        }
+    }
+}
+
+thread_local! {
+    /// One-entry cache of the instance-data lookup for the environment running
+    /// on this system thread. All JavaScript for an environment executes on a
+    /// single system thread, so after the first lookup every subsequent
+    /// `InstanceData::get` on the hot path (e.g., `LocalKey` access) is a
+    /// plain thread-local load instead of a call into the engine.
+    static INSTANCE_DATA_CACHE: Cell<(Env, *mut InstanceData)> =
+        const { Cell::new((ptr::null_mut(), ptr::null_mut())) };
+}
+
+impl Drop for InstanceData {
+    fn drop(&mut self) {
+        // The instance-data finalizer runs on the environment's own thread;
+        // clearing the cache here guarantees that an environment later
+        // allocated at the same address cannot observe freed instance data.
+        // `try_with` because thread-local storage may already be destroyed
+        // during process exit.
+        let _ = INSTANCE_DATA_CACHE.try_with(|cache| {
+            if ptr::eq(cache.get().1, self) {
+                cache.set((ptr::null_mut(), ptr::null_mut()));
+            }
+        });
+    }
+}
+
 impl InstanceData {
     /// Return the data associated with this module instance, lazily initializing if
     /// necessary.
@@ -242,17 +326,25 @@ impl InstanceData {
     /// `Context` reference ensures serialized access.
     pub(crate) fn get<'cx, C: Context<'cx>>(cx: &mut C) -> &mut InstanceData {
         let env = cx.env().to_raw();
-        let data = unsafe { lifecycle::get_instance_data::<InstanceData>(env).as_mut() };
 
-        if let Some(data) = data {
+        let (cached_env, cached) = INSTANCE_DATA_CACHE.with(Cell::get);
+
+        if cached_env == env && !cached.is_null() {
+            // Safety: the cache entry is cleared when the instance data is
+            // dropped, so a non-null hit always points to live data for this
+            // environment.
+            return unsafe { &mut *cached };
+        }
+
+        let data = unsafe { lifecycle::get_instance_data::<InstanceData>(env) };
+
+        if let Some(data) = unsafe { data.as_mut() } {
+            INSTANCE_DATA_CACHE.with(|cache| cache.set((env, data)));
+
             return data;
         }
 
-        let drop_queue = unsafe {
-            let queue = ThreadsafeFunction::new(env, DropData::drop);
-            queue.unref(env);
-            queue
-        };
+        let drop_queue = unsafe { DropQueue::new(env) };
 
         let shared_channel = {
             let mut channel = Channel::new(cx);
@@ -267,13 +359,15 @@ impl InstanceData {
             locals: LocalTable::default(),
         };
 
-        unsafe { &mut *lifecycle::set_instance_data(env, data) }
+        let data = unsafe { &mut *lifecycle::set_instance_data(env, data) };
+
+        INSTANCE_DATA_CACHE.with(|cache| cache.set((env, data as *mut InstanceData)));
+
+        data
     }
 
     /// Helper to return a reference to the `drop_queue` field of `InstanceData`
-    pub(crate) fn drop_queue<'cx, C: Context<'cx>>(
-        cx: &mut C,
-    ) -> Arc<ThreadsafeFunction<DropData>> {
+    pub(crate) fn drop_queue<'cx, C: Context<'cx>>(cx: &mut C) -> Arc<DropQueue> {
         Arc::clone(&InstanceData::get(cx).drop_queue)
     }
 
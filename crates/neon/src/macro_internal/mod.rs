@@ -22,9 +22,115 @@ mod futures;
 
 type Export<'cx> = (&'static str, Handle<'cx, JsValue>);
 
+// Constructor for derived `TryFromJs` implementations; `TypeExpected` cannot
+// be created outside of the crate.
+pub fn type_expected<T: crate::types::Value>() -> crate::types::extract::TypeExpected<T> {
+    crate::types::extract::TypeExpected::new()
+}
+
+// Function constructor for `#[neon::export(unwind = "abort")]`. A panic in
+// `f` unwinds into the `extern "C"` trampoline, which aborts the process.
+pub fn create_function_abort_unwind<'cx, C, F, V>(
+    cx: &mut C,
+    name: &str,
+    f: F,
+) -> JsResult<'cx, crate::types::JsFunction>
+where
+    C: Context<'cx>,
+    F: Fn(crate::context::FunctionContext) -> JsResult<V> + 'static,
+    V: crate::types::Value,
+{
+    crate::types::JsFunction::with_name_abort_unwind(cx, name, f)
+}
+
 #[linkme::distributed_slice]
 pub static EXPORTS: [for<'cx> fn(&mut ModuleContext<'cx>) -> NeonResult<Export<'cx>>];
 
+// A function export registered with `#[neon::export(lazy)]`. Instead of
+// eagerly creating the `JsFunction` at module load, registration defines an
+// accessor property whose getter materializes the function on first access.
+pub struct LazyExport {
+    pub name: &'static str,
+    pub create: for<'cx> fn(&mut Cx<'cx>) -> JsResult<'cx, JsValue>,
+}
+
+#[linkme::distributed_slice]
+pub static LAZY_EXPORTS: [LazyExport];
+
+// Builds the property descriptor registering a lazy export. The entry itself
+// is threaded through the descriptor's data pointer, so registration does no
+// per-export work beyond filling in the descriptor.
+pub(crate) fn lazy_descriptor(
+    key: crate::sys::raw::Local,
+    entry: &'static LazyExport,
+) -> crate::sys::bindings::PropertyDescriptor {
+    use crate::sys::bindings::PropertyAttributes;
+
+    crate::sys::bindings::PropertyDescriptor {
+        utf8name: std::ptr::null(),
+        name: key,
+        method: None,
+        getter: Some(lazy_export_getter),
+        setter: None,
+        value: std::ptr::null_mut(),
+        // Configurable so the getter can replace itself with the
+        // materialized function
+        attributes: PropertyAttributes::ENUMERABLE | PropertyAttributes::CONFIGURABLE,
+        data: entry as *const LazyExport as *mut std::os::raw::c_void,
+    }
+}
+
+// Getter trampoline for lazy exports. Creates the exported function, caches
+// it by redefining the property as a plain value on the exports object, and
+// returns it.
+unsafe extern "C" fn lazy_export_getter(
+    env: crate::sys::raw::Env,
+    info: crate::sys::bindings::CallbackInfo,
+) -> crate::sys::raw::Local {
+    use std::{mem::MaybeUninit, panic::AssertUnwindSafe, ptr};
+
+    use crate::{
+        result::Throw,
+        sys,
+        types::{error::convert_panics, private::ValueInternal},
+    };
+
+    let mut this = MaybeUninit::uninit();
+    let mut data = MaybeUninit::uninit();
+
+    sys::bindings::get_cb_info(
+        env,
+        info,
+        ptr::null_mut(),
+        ptr::null_mut(),
+        this.as_mut_ptr(),
+        data.as_mut_ptr(),
+    )
+    .unwrap();
+
+    let this = this.assume_init();
+    let entry = &*data.assume_init().cast::<LazyExport>();
+
+    Cx::with_context(env.into(), |mut cx| {
+        convert_panics(
+            env.into(),
+            AssertUnwindSafe(|| {
+                let value = (entry.create)(&mut cx)?;
+                let key = cx.string(entry.name);
+                let descriptor = crate::object::props::descriptor(key.to_local(), value.to_local());
+
+                match sys::object::define_properties(env, this, &[descriptor]) {
+                    Ok(()) => Ok(value),
+                    Err(sys::Status::PendingException) => Err(Throw::new()),
+                    _ => cx.throw_type_error("failed to cache lazy export"),
+                }
+            }),
+        )
+        .map(|value| value.to_local())
+        .unwrap_or_else(|_: Throw| ptr::null_mut())
+    })
+}
+
 #[linkme::distributed_slice]
 pub static MAIN: [for<'cx> fn(ModuleContext<'cx>) -> NeonResult<()>];
 
@@ -215,6 +215,25 @@ pub use neon_macros::main;
 /// # }
 /// ```
 ///
+/// ### Lazy exports
+///
+/// By default, every exported function is created when the module loads. For
+/// addons with a large export surface where most exports go unused in a given
+/// process, the `lazy` attribute defers creating the function until the first
+/// time the property is accessed. Until then, the export is defined as an
+/// accessor on the module, so `Object.keys(addon)` and similar reflection are
+/// unchanged.
+///
+/// ```
+/// #[neon::export(lazy)]
+/// fn rarely_used(a: f64, b: f64) -> f64 {
+///     a + b
+/// }
+/// ```
+///
+/// Lazy exports are registered by [`neon::registered().export(..)`](crate::Exports::export);
+/// they are not included when iterating [`neon::registered()`](crate::registered) manually.
+///
 /// ### Error Handling
 ///
 /// If an exported function returns a [`Result`], a JavaScript exception will be thrown
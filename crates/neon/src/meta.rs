@@ -2,6 +2,90 @@
 
 use semver::Version;
 
+#[cfg(feature = "stats")]
+pub(crate) mod counters {
+    //! Relaxed-atomic counters threaded through binding hot paths.
+    //!
+    //! The counters are only ever read as a point-in-time snapshot, so plain
+    //! relaxed operations are sufficient and keep the instrumentation cost to
+    //! a single uncontended atomic add per event.
+
+    use std::sync::atomic::{AtomicU64, Ordering};
+
+    pub(crate) static TSFN_CALLS: AtomicU64 = AtomicU64::new(0);
+    pub(crate) static TSFN_QUEUE_DEPTH: AtomicU64 = AtomicU64::new(0);
+    pub(crate) static ROOT_DROPS_PENDING: AtomicU64 = AtomicU64::new(0);
+    pub(crate) static LEDGER_BORROWS: AtomicU64 = AtomicU64::new(0);
+    pub(crate) static LEDGER_BORROW_FAILURES: AtomicU64 = AtomicU64::new(0);
+
+    pub(crate) fn tsfn_call() {
+        TSFN_CALLS.fetch_add(1, Ordering::Relaxed);
+        TSFN_QUEUE_DEPTH.fetch_add(1, Ordering::Relaxed);
+    }
+
+    pub(crate) fn tsfn_drain() {
+        TSFN_QUEUE_DEPTH.fetch_sub(1, Ordering::Relaxed);
+    }
+
+    pub(crate) fn root_drop_queued() {
+        ROOT_DROPS_PENDING.fetch_add(1, Ordering::Relaxed);
+    }
+
+    pub(crate) fn root_drop_completed() {
+        ROOT_DROPS_PENDING.fetch_sub(1, Ordering::Relaxed);
+    }
+
+    pub(crate) fn ledger_borrow(ok: bool) {
+        LEDGER_BORROWS.fetch_add(1, Ordering::Relaxed);
+
+        if !ok {
+            LEDGER_BORROW_FAILURES.fetch_add(1, Ordering::Relaxed);
+        }
+    }
+}
+
+/// Point-in-time snapshot of the binding-layer instrumentation counters.
+///
+/// Produced by [`stats()`]; the fields are suitable for direct export as
+/// monitoring gauges and counters.
+#[cfg(feature = "stats")]
+#[cfg_attr(docsrs, doc(cfg(feature = "stats")))]
+#[non_exhaustive]
+#[derive(Clone, Copy, Debug)]
+pub struct Stats {
+    /// Total number of threadsafe function calls scheduled (e.g., by
+    /// [`Channel::send`](crate::event::Channel::send)).
+    pub tsfn_calls: u64,
+    /// Number of scheduled threadsafe function callbacks that have not yet
+    /// run on the JavaScript thread.
+    pub tsfn_queue_depth: u64,
+    /// Number of [`Root`](crate::handle::Root)s dropped on non-JavaScript
+    /// threads whose references have not yet been released.
+    pub root_drops_pending: u64,
+    /// Total number of dynamically checked buffer borrows.
+    pub ledger_borrows: u64,
+    /// Number of buffer borrows rejected by the borrow ledger.
+    pub ledger_borrow_failures: u64,
+}
+
+/// Produces a snapshot of the binding-layer instrumentation counters.
+///
+/// The counters are updated with relaxed atomics, so the snapshot is not a
+/// consistent cut across threads; individual values are exact totals.
+#[cfg(feature = "stats")]
+#[cfg_attr(docsrs, doc(cfg(feature = "stats")))]
+pub fn stats() -> Stats {
+    use std::sync::atomic::Ordering;
+
+    Stats {
+        tsfn_calls: counters::TSFN_CALLS.load(Ordering::Relaxed),
+        tsfn_queue_depth: counters::TSFN_QUEUE_DEPTH.load(Ordering::Relaxed),
+        root_drops_pending: counters::ROOT_DROPS_PENDING.load(Ordering::Relaxed),
+        ledger_borrows: counters::LEDGER_BORROWS.load(Ordering::Relaxed),
+        ledger_borrow_failures: counters::LEDGER_BORROW_FAILURES.load(Ordering::Relaxed),
+    }
+}
+
 /// The Neon version.
 pub const VERSION: &str = env!("CARGO_PKG_VERSION");
 
@@ -0,0 +1,156 @@
+//! Interned property keys.
+
+use std::sync::atomic::{AtomicU32, Ordering};
+
+use crate::{
+    context::{Context, Cx},
+    handle::Root,
+    object::{Object, PropertyKey},
+    result::{JsResult, ResultExt, Throw},
+    sys::{self, raw},
+    thread::LocalKey,
+    types::{build, extract::TryIntoJs, private::ValueInternal, JsArray, JsString},
+};
+
+/// The per-instance registry of interned key strings.
+///
+/// Rooting the registry array keeps every interned `JsString` alive for the
+/// lifetime of the module instance, so keys can be reused across property
+/// accesses without re-materializing them from UTF-8.
+struct Keys {
+    strings: Root<JsArray>,
+    // Only mutated from the JavaScript thread that owns the instance, so
+    // relaxed ordering is sufficient.
+    len: AtomicU32,
+}
+
+static KEYS: LocalKey<Keys> = LocalKey::new();
+
+/// An interned property key.
+///
+/// Accessing a property with a string key creates a new JavaScript string for
+/// the key on every access. For property names that are used repeatedly — for
+/// example, reading the same fields off of many option objects — a `Key`
+/// caches the key string the first time it is used in each module instance,
+/// so that subsequent accesses reuse a single interned `JsString` instead of
+/// creating a new one each call.
+///
+/// Since the cache is tied to the module instance, a `Key` is designed to be
+/// stored in a `static`:
+///
+/// ```
+/// # use neon::prelude::*;
+/// use neon::object::Key;
+///
+/// static NAME: Key = Key::new("name");
+///
+/// fn get_name(mut cx: FunctionContext) -> JsResult<JsValue> {
+///     let obj: Handle<JsObject> = cx.argument(0)?;
+///     obj.prop(&mut cx, &NAME).get()
+/// }
+/// ```
+pub struct Key {
+    name: &'static str,
+    slot: LocalKey<u32>,
+}
+
+impl Key {
+    /// Creates a new interned key for the property `name`. This method is
+    /// `const`, so it can be assigned to static variables.
+    pub const fn new(name: &'static str) -> Self {
+        Self {
+            name,
+            slot: LocalKey::new(),
+        }
+    }
+
+    /// Returns the property name interned by this key.
+    pub fn name(&self) -> &'static str {
+        self.name
+    }
+
+    /// Produces the interned JavaScript string for this key, creating and
+    /// caching it if this is its first use in the current module instance.
+    pub fn to_string<'cx, C: Context<'cx>>(&'static self, cx: &mut C) -> JsResult<'cx, JsString> {
+        let slot = *self.slot.get_or_try_init(cx, |cx| {
+            let keys = KEYS.get_or_try_init(cx, |cx| {
+                Ok(Keys {
+                    strings: JsArray::new(cx, 0).root(cx),
+                    len: AtomicU32::new(0),
+                })
+            })?;
+
+            let index = keys.len.load(Ordering::Relaxed);
+            let strings = keys.strings.to_inner(cx);
+            let string = JsString::try_new(cx, self.name).or_throw(cx)?;
+
+            let mut result = false;
+            unsafe {
+                if !sys::object::set_index(
+                    &mut result,
+                    cx.env().to_raw(),
+                    strings.to_local(),
+                    index,
+                    string.to_local(),
+                ) {
+                    return Err(Throw::new());
+                }
+            }
+
+            keys.len.store(index + 1, Ordering::Relaxed);
+
+            Ok(index)
+        })?;
+
+        // Unwrap safety: initializing the slot above also initializes the registry.
+        let strings = KEYS.get(cx).unwrap().strings.to_inner(cx);
+        let env = cx.env();
+
+        build(env, |out| unsafe {
+            sys::object::get_index(out, env.to_raw(), strings.to_local(), slot)
+        })
+    }
+}
+
+// Converting a key produces its interned string, so keys can be used directly
+// as the key halves of a batched `props().set_many(..)` write.
+impl<'cx> TryIntoJs<'cx> for &'static Key {
+    type Value = JsString;
+
+    fn try_into_js(self, cx: &mut Cx<'cx>) -> JsResult<'cx, JsString> {
+        self.to_string(cx)
+    }
+}
+
+impl PropertyKey for &'static Key {
+    unsafe fn get_from<'c, C: Context<'c>>(
+        self,
+        cx: &mut C,
+        out: &mut raw::Local,
+        obj: raw::Local,
+    ) -> bool {
+        let key = match self.to_string(cx) {
+            Ok(key) => key,
+            // An exception is already pending.
+            Err(_) => return false,
+        };
+
+        sys::object::get(out, cx.env().to_raw(), obj, key.to_local())
+    }
+
+    unsafe fn set_from<'c, C: Context<'c>>(
+        self,
+        cx: &mut C,
+        out: &mut bool,
+        obj: raw::Local,
+        val: raw::Local,
+    ) -> bool {
+        let key = match self.to_string(cx) {
+            Ok(key) => key,
+            // An exception is already pending.
+            Err(_) => return false,
+        };
+
+        sys::object::set(out, cx.env().to_raw(), obj, key.to_local(), val)
+    }
+}
@@ -28,11 +28,23 @@
 //! }
 //! ```
 //!
+//! For property names that are accessed frequently, the [`Key`] type can be
+//! used to intern the key string once per module instance, avoiding the cost
+//! of re-creating a JavaScript string on every access.
+//!
 //! [hierarchy]: crate::types#the-javascript-type-hierarchy
 //! [symbol]: https://developer.mozilla.org/en-US/docs/Web/JavaScript/Reference/Global_Objects/Symbol
 
+mod keys;
+pub(crate) mod props;
+
 use smallvec::smallvec;
 
+pub use self::{
+    keys::Key,
+    props::{PropertyKeys, PropertyWrites, PropsOptions},
+};
+
 use crate::{
     context::{internal::ContextInternal, Context, Cx},
     handle::{Handle, Root},
@@ -275,6 +287,18 @@ pub trait Object: Value {
         PropOptions { cx, this, key }
     }
 
+    /// Create a [`PropsOptions`] for accessing multiple properties in a batch.
+    ///
+    /// # Safety
+    ///
+    /// See [`Object::prop()`](Object::prop) for why replacing the lifetime
+    /// `'self` with `'cx` is safe.
+    fn props<'a, 'cx: 'a>(&self, cx: &'a mut Cx<'cx>) -> PropsOptions<'a, 'cx, Self> {
+        let this: Handle<'_, Self> =
+            Handle::new_internal(unsafe { ValueInternal::from_local(cx.env(), self.to_local()) });
+        PropsOptions { cx, this }
+    }
+
     /// Gets a property from the object as a method and binds `this` to the object.
     ///
     /// May throw an exception either from accessing the property.
@@ -0,0 +1,267 @@
+//! Batched property access.
+
+use std::ptr;
+
+use crate::{
+    context::{internal::ContextInternal, Context, Cx},
+    handle::Handle,
+    object::{Object, PropertyKey},
+    result::{NeonResult, Throw},
+    sys,
+    types::{
+        extract::{TryFromJs, TryIntoJs},
+        private::ValueInternal,
+    },
+};
+
+pub(crate) mod private {
+    use smallvec::SmallVec;
+
+    use crate::{context::Cx, handle::Handle, object::Object, result::NeonResult, sys};
+
+    pub type DescriptorsVec = SmallVec<[sys::bindings::PropertyDescriptor; 8]>;
+
+    /// This type marks the `PropertyKeys` trait as sealed.
+    pub trait PropertyKeysInternal<'cx, V> {
+        fn get_from_object<O: Object>(
+            self,
+            cx: &mut Cx<'cx>,
+            this: Handle<'cx, O>,
+        ) -> NeonResult<V>;
+    }
+
+    /// This type marks the `PropertyWrites` trait as sealed.
+    pub trait PropertyWritesInternal<'cx> {
+        fn stage(self, cx: &mut Cx<'cx>, out: &mut DescriptorsVec) -> NeonResult<()>;
+    }
+}
+
+/// A builder for accessing multiple object properties in a batch.
+///
+/// Where [`PropOptions`](crate::object::PropOptions) reads or writes one
+/// property per call, the builder methods of `PropsOptions` operate on a
+/// whole tuple of properties at a time. In particular,
+/// [`set_many()`](PropsOptions::set_many) stages all of the writes and
+/// commits them to the object with a single batched property-definition
+/// call, so writing N fields costs one boundary crossing instead of N.
+///
+/// ```
+/// # use neon::prelude::*;
+/// # fn foo(mut cx: FunctionContext) -> JsResult<JsUndefined> {
+/// # let obj: Handle<JsObject> = cx.argument(0)?;
+/// let (x, y): (f64, f64) = obj.props(&mut cx).get_all(("x", "y"))?;
+///
+/// obj.props(&mut cx)
+///     .set_many((("x", x + 1.0), ("y", y + 1.0)))?;
+/// # Ok(cx.undefined())
+/// # }
+/// ```
+pub struct PropsOptions<'a, 'cx, O>
+where
+    'cx: 'a,
+    O: Object,
+{
+    pub(crate) cx: &'a mut Cx<'cx>,
+    pub(crate) this: Handle<'cx, O>,
+}
+
+impl<'a, 'cx, O> PropsOptions<'a, 'cx, O>
+where
+    'cx: 'a,
+    O: Object,
+{
+    /// Returns the original object from which the properties are accessed.
+    pub fn this(&self) -> Handle<'cx, O> {
+        self.this
+    }
+
+    /// Gets all of the properties named by the tuple of keys and attempts to
+    /// convert each one to a Rust value.
+    ///
+    /// May throw an exception either during accessing a property or converting
+    /// a result type.
+    pub fn get_all<V, K>(&mut self, keys: K) -> NeonResult<V>
+    where
+        K: PropertyKeys<'cx, V>,
+    {
+        keys.get_from_object(self.cx, self.this)
+    }
+
+    /// Sets all of the properties given as a tuple of `(key, value)` pairs,
+    /// committing them to the object with a single batched call.
+    ///
+    /// The properties are created writable, enumerable, and configurable,
+    /// matching the semantics of ordinary property assignment. Keys must
+    /// convert to strings (or symbols); numeric indices are not supported.
+    ///
+    /// May throw an exception either during converting a key or value or
+    /// defining the properties.
+    pub fn set_many<W>(&mut self, writes: W) -> NeonResult<&mut Self>
+    where
+        W: PropertyWrites<'cx>,
+    {
+        let mut descriptors = private::DescriptorsVec::new();
+        writes.stage(self.cx, &mut descriptors)?;
+
+        let env = self.cx.env();
+
+        unsafe {
+            match sys::object::define_properties(env.to_raw(), self.this.to_local(), &descriptors) {
+                Ok(()) => Ok(self),
+                Err(sys::Status::PendingException) => Err(Throw::new()),
+                _ => self.cx.throw_type_error("failed to define properties"),
+            }
+        }
+    }
+}
+
+pub(crate) fn descriptor(key: sys::raw::Local, value: sys::raw::Local) -> sys::bindings::PropertyDescriptor {
+    sys::bindings::PropertyDescriptor {
+        utf8name: ptr::null(),
+        name: key,
+        method: None,
+        getter: None,
+        setter: None,
+        value,
+        attributes: sys::bindings::PropertyAttributes::WRITABLE
+            | sys::bindings::PropertyAttributes::ENUMERABLE
+            | sys::bindings::PropertyAttributes::CONFIGURABLE,
+        data: ptr::null_mut(),
+    }
+}
+
+/// The trait for specifying a tuple of property keys to read in a batch.
+/// This trait is sealed and cannot be implemented by types outside of the Neon crate.
+///
+/// **Note:** This trait is implemented for tuples of up to 32 keys,
+/// but for the sake of brevity, only tuples up to size 8 are shown in this documentation.
+pub trait PropertyKeys<'cx, V>: private::PropertyKeysInternal<'cx, V> {}
+
+macro_rules! impl_property_keys_expand {
+    {
+        $(#[$attrs:meta])?
+        [ $($prefix:ident => $pv:ident),* ];
+        [];
+    } => {};
+
+    {
+        $(#[$attrs:meta])?
+        [ $($prefix:ident => $pv:ident),* ];
+        [ $head:ident => $hv:ident $(, $tail:ident => $tv:ident)* ];
+    } => {
+        $(#[$attrs])?
+        impl<'cx, $($prefix: PropertyKey, $pv: TryFromJs<'cx>, )* $head: PropertyKey, $hv: TryFromJs<'cx>> private::PropertyKeysInternal<'cx, ($($pv, )* $hv, )> for ($($prefix, )* $head, ) {
+            #[allow(non_snake_case)]
+            fn get_from_object<O: Object>(self, cx: &mut Cx<'cx>, this: Handle<'cx, O>) -> NeonResult<($($pv, )* $hv, )> {
+                let ($($prefix, )* $head, ) = self;
+                $(
+                    let $prefix = this.get_value(cx, $prefix)?;
+                    let $prefix = $pv::from_js(cx, $prefix)?;
+                )*
+                let $head = this.get_value(cx, $head)?;
+                let $head = $hv::from_js(cx, $head)?;
+                Ok(($($prefix, )* $head, ))
+            }
+        }
+
+        $(#[$attrs])?
+        impl<'cx, $($prefix: PropertyKey, $pv: TryFromJs<'cx>, )* $head: PropertyKey, $hv: TryFromJs<'cx>> PropertyKeys<'cx, ($($pv, )* $hv, )> for ($($prefix, )* $head, ) {}
+
+        impl_property_keys_expand! {
+            $(#[$attrs])?
+            [ $($prefix => $pv, )* $head => $hv ];
+            [ $($tail => $tv),* ];
+        }
+    }
+}
+
+macro_rules! impl_property_keys {
+    {
+        [ $($show:ident => $show_v:ident),* ];
+        [ $($hide:ident => $hide_v:ident),* ];
+    } => {
+        impl_property_keys_expand! { []; [ $($show => $show_v),* ]; }
+        impl_property_keys_expand! { #[doc(hidden)] [ $($show => $show_v),* ]; [ $($hide => $hide_v),* ]; }
+    }
+}
+
+impl_property_keys! {
+    // Tuples up to length 8 are included in the docs.
+    [K1 => V1, K2 => V2, K3 => V3, K4 => V4, K5 => V5, K6 => V6, K7 => V7, K8 => V8];
+
+    // Tuples up to length 32 are not included in the docs.
+    [
+        K9 => V9, K10 => V10, K11 => V11, K12 => V12, K13 => V13, K14 => V14, K15 => V15, K16 => V16,
+        K17 => V17, K18 => V18, K19 => V19, K20 => V20, K21 => V21, K22 => V22, K23 => V23, K24 => V24,
+        K25 => V25, K26 => V26, K27 => V27, K28 => V28, K29 => V29, K30 => V30, K31 => V31, K32 => V32
+    ];
+}
+
+/// The trait for specifying a tuple of `(key, value)` pairs to write in a batch.
+/// This trait is sealed and cannot be implemented by types outside of the Neon crate.
+///
+/// **Note:** This trait is implemented for tuples of up to 32 pairs,
+/// but for the sake of brevity, only tuples up to size 8 are shown in this documentation.
+pub trait PropertyWrites<'cx>: private::PropertyWritesInternal<'cx> {}
+
+macro_rules! impl_property_writes_expand {
+    {
+        $(#[$attrs:meta])?
+        [ $($prefix:ident => $pv:ident),* ];
+        [];
+    } => {};
+
+    {
+        $(#[$attrs:meta])?
+        [ $($prefix:ident => $pv:ident),* ];
+        [ $head:ident => $hv:ident $(, $tail:ident => $tv:ident)* ];
+    } => {
+        $(#[$attrs])?
+        impl<'cx, $($prefix: TryIntoJs<'cx>, $pv: TryIntoJs<'cx>, )* $head: TryIntoJs<'cx>, $hv: TryIntoJs<'cx>> private::PropertyWritesInternal<'cx> for ($(($prefix, $pv), )* ($head, $hv), ) {
+            #[allow(non_snake_case)]
+            fn stage(self, cx: &mut Cx<'cx>, out: &mut private::DescriptorsVec) -> NeonResult<()> {
+                let ($($prefix, )* $head, ) = self;
+                $(
+                    let key = $prefix.0.try_into_js(cx)?.to_local();
+                    let value = $prefix.1.try_into_js(cx)?.to_local();
+                    out.push(descriptor(key, value));
+                )*
+                let key = $head.0.try_into_js(cx)?.to_local();
+                let value = $head.1.try_into_js(cx)?.to_local();
+                out.push(descriptor(key, value));
+                Ok(())
+            }
+        }
+
+        $(#[$attrs])?
+        impl<'cx, $($prefix: TryIntoJs<'cx>, $pv: TryIntoJs<'cx>, )* $head: TryIntoJs<'cx>, $hv: TryIntoJs<'cx>> PropertyWrites<'cx> for ($(($prefix, $pv), )* ($head, $hv), ) {}
+
+        impl_property_writes_expand! {
+            $(#[$attrs])?
+            [ $($prefix => $pv, )* $head => $hv ];
+            [ $($tail => $tv),* ];
+        }
+    }
+}
+
+macro_rules! impl_property_writes {
+    {
+        [ $($show:ident => $show_v:ident),* ];
+        [ $($hide:ident => $hide_v:ident),* ];
+    } => {
+        impl_property_writes_expand! { []; [ $($show => $show_v),* ]; }
+        impl_property_writes_expand! { #[doc(hidden)] [ $($show => $show_v),* ]; [ $($hide => $hide_v),* ]; }
+    }
+}
+
+impl_property_writes! {
+    // Tuples up to length 8 are included in the docs.
+    [K1 => V1, K2 => V2, K3 => V3, K4 => V4, K5 => V5, K6 => V6, K7 => V7, K8 => V8];
+
+    // Tuples up to length 32 are not included in the docs.
+    [
+        K9 => V9, K10 => V10, K11 => V11, K12 => V12, K13 => V13, K14 => V14, K15 => V15, K16 => V16,
+        K17 => V17, K18 => V18, K19 => V19, K20 => V20, K21 => V21, K22 => V22, K23 => V23, K24 => V24,
+        K25 => V25, K26 => V26, K27 => V27, K28 => V28, K29 => V29, K30 => V30, K31 => V31, K32 => V32
+    ];
+}
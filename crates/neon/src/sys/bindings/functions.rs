@@ -180,6 +180,13 @@ mod napi1 {
 
             fn set_property(env: Env, object: Value, key: Value, value: Value) -> Status;
 
+            fn define_properties(
+                env: Env,
+                object: Value,
+                property_count: usize,
+                properties: *const PropertyDescriptor,
+            ) -> Status;
+
             fn get_property(env: Env, object: Value, key: Value, result: *mut Value) -> Status;
 
             fn set_element(env: Env, object: Value, index: u32, value: Value) -> Status;
@@ -407,6 +414,122 @@ mod napi8 {
     );
 }
 
+// The `node_api_create_external_string_*` additions are experimental and may
+// be missing from Node-API compatible runtimes, so they are loaded as optional
+// symbols without the startup warning that `generate!` emits; callers are
+// expected to check [`has_external_strings`] and fall back to copying when
+// they are unavailable.
+#[cfg(feature = "napi-8")]
+mod experimental {
+    use std::os::raw::{c_char, c_void};
+
+    use super::super::types::*;
+
+    type CreateExternalStringLatin1 = unsafe extern "C" fn(
+        env: Env,
+        str_: *const c_char,
+        length: usize,
+        finalize_cb: Finalize,
+        finalize_hint: *mut c_void,
+        result: *mut Value,
+        copied: *mut bool,
+    ) -> Status;
+
+    type CreateExternalStringUtf16 = unsafe extern "C" fn(
+        env: Env,
+        str_: *const u16,
+        length: usize,
+        finalize_cb: Finalize,
+        finalize_hint: *mut c_void,
+        result: *mut Value,
+        copied: *mut bool,
+    ) -> Status;
+
+    struct NodeApi {
+        create_external_string_latin1: Option<CreateExternalStringLatin1>,
+        create_external_string_utf16: Option<CreateExternalStringUtf16>,
+    }
+
+    static mut NODE_API: NodeApi = NodeApi {
+        create_external_string_latin1: None,
+        create_external_string_utf16: None,
+    };
+
+    pub(super) unsafe fn load(host: &libloading::Library) {
+        NODE_API = NodeApi {
+            create_external_string_latin1: host
+                .get(b"node_api_create_external_string_latin1")
+                .ok()
+                .map(|symbol| *symbol),
+            create_external_string_utf16: host
+                .get(b"node_api_create_external_string_utf16")
+                .ok()
+                .map(|symbol| *symbol),
+        };
+    }
+
+    /// Indicates whether the runtime supports external string creation.
+    #[inline]
+    pub fn has_external_strings() -> bool {
+        let latin1 = unsafe { NODE_API.create_external_string_latin1 };
+        let utf16 = unsafe { NODE_API.create_external_string_utf16 };
+
+        latin1.is_some() && utf16.is_some()
+    }
+
+    #[cfg_attr(docsrs, doc(cfg(feature = "napi-8")))]
+    #[inline]
+    /// [`node_api_create_external_string_latin1`](https://nodejs.org/api/n-api.html#node_api_create_external_string_latin1)
+    ///
+    /// # Panics
+    /// Panics if the runtime does not support external strings; check
+    /// [`has_external_strings`] first.
+    pub unsafe fn create_external_string_latin1(
+        env: Env,
+        str_: *const c_char,
+        length: usize,
+        finalize_cb: Finalize,
+        finalize_hint: *mut c_void,
+        result: *mut Value,
+        copied: *mut bool,
+    ) -> ::core::result::Result<(), Status> {
+        let f = NODE_API
+            .create_external_string_latin1
+            .expect("node_api_create_external_string_latin1 has not been loaded");
+
+        match f(env, str_, length, finalize_cb, finalize_hint, result, copied) {
+            Status::Ok => Ok(()),
+            status => Err(status),
+        }
+    }
+
+    #[cfg_attr(docsrs, doc(cfg(feature = "napi-8")))]
+    #[inline]
+    /// [`node_api_create_external_string_utf16`](https://nodejs.org/api/n-api.html#node_api_create_external_string_utf16)
+    ///
+    /// # Panics
+    /// Panics if the runtime does not support external strings; check
+    /// [`has_external_strings`] first.
+    pub unsafe fn create_external_string_utf16(
+        env: Env,
+        str_: *const u16,
+        length: usize,
+        finalize_cb: Finalize,
+        finalize_hint: *mut c_void,
+        result: *mut Value,
+        copied: *mut bool,
+    ) -> ::core::result::Result<(), Status> {
+        let f = NODE_API
+            .create_external_string_utf16
+            .expect("node_api_create_external_string_utf16 has not been loaded");
+
+        match f(env, str_, length, finalize_cb, finalize_hint, result, copied) {
+            Status::Ok => Ok(()),
+            status => Err(status),
+        }
+    }
+}
+
 pub use napi1::*;
 #[cfg(feature = "napi-4")]
 pub use napi4::*;
@@ -417,6 +540,9 @@ pub use napi6::*;
 #[cfg(feature = "napi-8")]
 pub use napi8::*;
 
+#[cfg(feature = "napi-8")]
+pub use experimental::*;
+
 use super::{Env, Status};
 
 // This symbol is loaded separately because it is a prerequisite
@@ -468,5 +594,8 @@ pub(crate) unsafe fn load(env: Env) -> Result<(), libloading::Error> {
     #[cfg(feature = "napi-8")]
     napi8::load(&host);
 
+    #[cfg(feature = "napi-8")]
+    experimental::load(&host);
+
     Ok(())
 }
@@ -106,10 +106,14 @@ macro_rules! napi_name {
 ///     (NAPI.get_undefined)(env, result)
 /// }
 /// ```
+/// With the `static-napi` feature, the same definitions instead compile to an
+/// `extern "C"` block with `#[link_name = ...]` attributes, so every wrapper
+/// is a direct call resolved at link time and `load` is a no-op.
 macro_rules! generate {
     (#[$extern_attr:meta] extern "C" {
         $($(#[$attr:meta])? fn $name:ident($($param:ident: $ptype:ty$(,)?)*)$( -> $rtype:ty)?;)+
     }) => {
+        #[cfg(not(feature = "static-napi"))]
         struct Napi {
             $(
                 $name: unsafe extern "C" fn(
@@ -118,11 +122,13 @@ macro_rules! generate {
             )*
         }
 
+        #[cfg(not(feature = "static-napi"))]
         #[inline(never)]
         fn panic_load<T>() -> T {
             panic!("Node-API symbol has not been loaded")
         }
 
+        #[cfg(not(feature = "static-napi"))]
         static mut NAPI: Napi = {
             $(
                 unsafe extern "C" fn $name($(_: $ptype,)*)$( -> $rtype)* {
@@ -137,6 +143,7 @@ macro_rules! generate {
             }
         };
 
+        #[cfg(not(feature = "static-napi"))]
         pub(super) unsafe fn load(host: &libloading::Library) {
             let print_warn = |err| eprintln!("WARN: {}", err);
 
@@ -158,6 +165,7 @@ macro_rules! generate {
         }
 
         $(
+            #[cfg(not(feature = "static-napi"))]
             #[$extern_attr] $(#[$attr])? #[inline]
             #[doc = concat!(
                 "[`",
@@ -175,6 +183,46 @@ macro_rules! generate {
                 })*
             }
         )*
+
+        // Direct link-time bindings. The symbols are left undefined in the
+        // addon and resolved against the host process by the loader, exactly
+        // like any other native addon symbol.
+        #[cfg(feature = "static-napi")]
+        mod linked {
+            use super::*;
+
+            extern "C" {
+                $(
+                    $(#[$attr])?
+                    #[link_name = napi_name!($name)]
+                    pub(super) fn $name($($param: $ptype,)*)$( -> $rtype)*;
+                )*
+            }
+        }
+
+        // Symbols are resolved by the linker; nothing to do at startup.
+        #[cfg(feature = "static-napi")]
+        pub(super) unsafe fn load(_host: &libloading::Library) {}
+
+        $(
+            #[cfg(feature = "static-napi")]
+            #[$extern_attr] $(#[$attr])? #[inline]
+            #[doc = concat!(
+                "[`",
+                napi_name!($name),
+                "`](https://nodejs.org/api/n-api.html#",
+                napi_name!($name),
+                ")",
+            )]
+            pub unsafe fn $name($($param: $ptype,)*)$( -> ::core::result::Result<(), $rtype>)* {
+                #[allow(unused)]
+                let r = linked::$name($($param,)*);
+                $(match r {
+                    <$rtype>::Ok => Ok(()),
+                    status => Err(status)
+                })*
+            }
+        )*
     };
 }
 
@@ -257,6 +257,51 @@ impl std::ops::BitAndAssign for KeyFilter {
     }
 }
 
+#[repr(transparent)]
+#[derive(Debug, Copy, Clone, PartialEq, Eq, Hash)]
+#[cfg_attr(docsrs, doc(cfg(feature = "napi-1")))]
+/// [`napi_property_attributes`](https://nodejs.org/api/n-api.html#napi_property_attributes)
+pub struct PropertyAttributes(pub ::std::os::raw::c_uint);
+
+#[allow(dead_code)]
+impl PropertyAttributes {
+    pub const DEFAULT: PropertyAttributes = PropertyAttributes(0);
+    pub const WRITABLE: PropertyAttributes = PropertyAttributes(1);
+    pub const ENUMERABLE: PropertyAttributes = PropertyAttributes(2);
+    pub const CONFIGURABLE: PropertyAttributes = PropertyAttributes(4);
+    pub const STATIC: PropertyAttributes = PropertyAttributes(1024);
+}
+
+impl std::ops::BitOr<PropertyAttributes> for PropertyAttributes {
+    type Output = Self;
+    #[inline]
+    fn bitor(self, other: Self) -> Self {
+        PropertyAttributes(self.0 | other.0)
+    }
+}
+
+impl std::ops::BitOrAssign for PropertyAttributes {
+    #[inline]
+    fn bitor_assign(&mut self, rhs: PropertyAttributes) {
+        self.0 |= rhs.0;
+    }
+}
+
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+#[cfg_attr(docsrs, doc(cfg(feature = "napi-1")))]
+/// [`napi_property_descriptor`](https://nodejs.org/api/n-api.html#napi_property_descriptor)
+pub struct PropertyDescriptor {
+    pub utf8name: *const ::std::os::raw::c_char,
+    pub name: Value,
+    pub method: Callback,
+    pub getter: Callback,
+    pub setter: Callback,
+    pub value: Value,
+    pub attributes: PropertyAttributes,
+    pub data: *mut c_void,
+}
+
 #[repr(C)]
 #[derive(Debug, Copy, Clone)]
 #[doc(hidden)]
@@ -16,17 +16,31 @@ use super::{
 //   and requires heap allocation.
 const ARGV_SIZE: usize = 4;
 
-#[repr(transparent)]
-/// List of JavaScript arguments to a function
+/// List of JavaScript arguments to a function, along with its `this`-binding
 // `Arguments` is intended to be a small abstraction to hide the usage of
 // `SmallVec` allowing changes to `ARGV_SIZE` in a single location
-pub struct Arguments(SmallVec<[Local; ARGV_SIZE]>);
+pub struct Arguments {
+    this: Local,
+    argv: SmallVec<[Local; ARGV_SIZE]>,
+}
 
 impl Arguments {
     #[inline]
     /// Get an argument at a specific position
     pub fn get(&self, i: usize) -> Option<Local> {
-        self.0.get(i).cloned()
+        self.argv.get(i).cloned()
+    }
+
+    #[inline]
+    /// Get the number of arguments passed to the function
+    pub fn len(&self) -> usize {
+        self.argv.len()
+    }
+
+    #[inline]
+    /// Get the `this`-binding of the call
+    pub fn this(&self) -> Local {
+        self.this
     }
 }
 
@@ -44,10 +58,6 @@ pub unsafe fn is_construct(env: Env, info: FunctionCallbackInfo) -> bool {
     !target.is_null()
 }
 
-pub unsafe fn this(env: Env, info: FunctionCallbackInfo, out: &mut Local) {
-    napi::get_cb_info(env, info, null_mut(), null_mut(), out as *mut _, null_mut()).unwrap();
-}
-
 /// Gets the number of arguments passed to the function.
 // TODO: Remove this when `FunctionContext` is refactored to get call info upfront.
 pub unsafe fn len(env: Env, info: FunctionCallbackInfo) -> usize {
@@ -64,10 +74,12 @@ pub unsafe fn len(env: Env, info: FunctionCallbackInfo) -> usize {
     argc
 }
 
-/// Returns the function arguments for a call
+/// Returns the function arguments and `this`-binding for a call in a single
+/// `get_cb_info` call
 pub unsafe fn argv(env: Env, info: FunctionCallbackInfo) -> Arguments {
     // Allocate space on the stack for up to `ARGV_SIZE` values
     let mut argv = MaybeUninit::<[Local; ARGV_SIZE]>::uninit();
+    let mut this: MaybeUninit<Local> = MaybeUninit::zeroed();
 
     // Starts as the size allocated; after `get_cb_info` it is the number of arguments
     let mut argc = ARGV_SIZE;
@@ -77,11 +89,14 @@ pub unsafe fn argv(env: Env, info: FunctionCallbackInfo) -> Arguments {
         info,
         &mut argc as *mut _,
         argv.as_mut_ptr().cast(),
-        null_mut(),
+        this.as_mut_ptr(),
         null_mut(),
     )
     .unwrap();
 
+    // `get_cb_info` is guaranteed to assign to `this`
+    let this = this.assume_init();
+
     // We did not allocate enough space; allocate on the heap and try again
     let argv = if argc > ARGV_SIZE {
         // We know exactly how much space to reserve
@@ -106,5 +121,5 @@ pub unsafe fn argv(env: Env, info: FunctionCallbackInfo) -> Arguments {
         SmallVec::from_buf_and_len(argv.assume_init(), argc)
     };
 
-    Arguments(argv)
+    Arguments { this, argv }
 }
@@ -132,6 +132,15 @@ pub unsafe fn set_string(
     true
 }
 
+/// Defines all of the given `properties` on `object` with a single call.
+pub unsafe fn define_properties(
+    env: Env,
+    object: Local,
+    properties: &[napi::PropertyDescriptor],
+) -> Result<(), napi::Status> {
+    napi::define_properties(env, object, properties.len(), properties.as_ptr())
+}
+
 /// Mutates `out` to refer to the value of the property of `object` named by the `key` value.
 /// Returns false if the value couldn't be retrieved.
 pub unsafe fn get(out: &mut Local, env: Env, object: Local, key: Local) -> bool {
@@ -1,5 +1,8 @@
 use std::{mem::MaybeUninit, ptr};
 
+#[cfg(feature = "napi-8")]
+use std::os::raw::c_void;
+
 use super::{
     bindings as napi,
     raw::{Env, Local},
@@ -41,6 +44,77 @@ pub unsafe fn data_utf16(env: Env, out: *mut u16, len: usize, value: Local) -> u
     read.assume_init()
 }
 
+/// Indicates whether the runtime supports zero-copy external string creation.
+#[cfg(feature = "napi-8")]
+pub fn has_external_strings() -> bool {
+    napi::has_external_strings()
+}
+
+#[cfg(feature = "napi-8")]
+extern "C" fn finalize_external_string<T: 'static>(
+    _env: Env,
+    _data: *mut c_void,
+    // The finalize hint is the raw pointer to the boxed Rust buffer that owns
+    // the string contents.
+    hint: *mut c_void,
+) {
+    unsafe {
+        drop(Box::<T>::from_raw(hint.cast()));
+    }
+}
+
+/// Creates a JavaScript string that references the Latin-1 bytes of `data`
+/// without copying. Ownership of the buffer is transferred to the garbage
+/// collector, which drops it when the string is collected (or immediately,
+/// if the runtime chose to make a copy after all).
+///
+/// The caller must check [`has_external_strings`] first.
+#[cfg(feature = "napi-8")]
+pub unsafe fn new_external_latin1(out: &mut Local, env: Env, data: Vec<u8>) -> bool {
+    let data = Box::new(data);
+    let (ptr, len) = (data.as_ptr(), data.len());
+    let hint = Box::into_raw(data);
+    let mut copied = false;
+
+    let status = napi::create_external_string_latin1(
+        env,
+        ptr as *const _,
+        len,
+        Some(finalize_external_string::<Vec<u8>>),
+        hint.cast(),
+        out,
+        &mut copied,
+    );
+
+    status.is_ok()
+}
+
+/// Creates a JavaScript string that references the UTF-16 code units of
+/// `data` without copying. Ownership of the buffer is transferred to the
+/// garbage collector, which drops it when the string is collected (or
+/// immediately, if the runtime chose to make a copy after all).
+///
+/// The caller must check [`has_external_strings`] first.
+#[cfg(feature = "napi-8")]
+pub unsafe fn new_external_utf16(out: &mut Local, env: Env, data: Vec<u16>) -> bool {
+    let data = Box::new(data);
+    let (ptr, len) = (data.as_ptr(), data.len());
+    let hint = Box::into_raw(data);
+    let mut copied = false;
+
+    let status = napi::create_external_string_utf16(
+        env,
+        ptr,
+        len,
+        Some(finalize_external_string::<Vec<u16>>),
+        hint.cast(),
+        out,
+        &mut copied,
+    );
+
+    status.is_ok()
+}
+
 pub unsafe fn run_script(out: &mut Local, env: Env, value: Local) -> bool {
     let status = napi::run_script(env, value, out as *mut _);
 
@@ -111,7 +111,12 @@ impl<T: Send + 'static> ThreadsafeFunction<T> {
         };
 
         match status {
-            Ok(()) => Ok(()),
+            Ok(()) => {
+                #[cfg(feature = "stats")]
+                crate::meta::counters::tsfn_call();
+
+                Ok(())
+            }
             Err(status) => {
                 // Prevent further calls to `call_threadsafe_function`
                 if status == napi::Status::Closing {
@@ -165,6 +170,9 @@ impl<T: Send + 'static> ThreadsafeFunction<T> {
     ) {
         let Callback { callback, data } = *Box::from_raw(data as *mut Callback<T>);
 
+        #[cfg(feature = "stats")]
+        crate::meta::counters::tsfn_drain();
+
         BOUNDARY.catch_failure(env, None, move |env| {
             callback(env, data);
             ptr::null_mut()
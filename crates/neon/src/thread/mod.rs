@@ -126,6 +126,10 @@ fn next_id() -> usize {
 /// of `LocalKey`, and values that implement [`Drop`] get destructed when
 /// the JavaScript thread exits, i.e. when a worker thread terminates or the main thread
 /// terminates on process exit.
+///
+/// After a thread's first access, lookups resolve through a thread-local
+/// cache of the instance-data table, so reading an initialized `LocalKey`
+/// performs no synchronization and no calls into the JavaScript engine.
 #[derive(Default)]
 pub struct LocalKey<T> {
     _type: PhantomData<T>,
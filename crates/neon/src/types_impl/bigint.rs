@@ -8,9 +8,13 @@ use crate::{
         Context, Cx,
     },
     handle::{internal::TransparentNoCopyWrapper, Handle},
-    result::{NeonResult, ResultExt},
+    object::Object,
+    result::{JsResult, NeonResult, ResultExt},
     sys::{self, raw},
-    types::{private, JsBigInt, Value},
+    types::{
+        buffer::TypedArray, private, JsArray, JsBigInt, JsBigInt64Array, JsBigUint64Array,
+        JsFunction, Value,
+    },
 };
 
 #[derive(Copy, Clone, Debug, PartialEq, Eq)]
@@ -332,7 +336,17 @@ impl JsBigInt {
     where
         C: Context<'cx>,
     {
-        let mut v = vec![0; self.len(cx)];
+        // Probe with inline storage first; values that fit in 128 bits (the
+        // common case) are read with a single call instead of asking for the
+        // length up front.
+        let mut inline = [0; 2];
+        let (sign, len) = self.read_digits_le(cx, &mut inline);
+
+        if len <= inline.len() {
+            return (sign, inline[..len].to_vec());
+        }
+
+        let mut v = vec![0; len];
         let (sign, len) = self.read_digits_le(cx, &mut v);
 
         // It shouldn't be possible for the number of digits to change. If it
@@ -402,6 +416,81 @@ impl JsBigInt {
         // Get the length by reading into an empty slice and ignoring the sign
         self.read_digits_le(cx, &mut []).1
     }
+
+    /// Constructs an array of `BigInt` elements from a slice of `u64` values.
+    ///
+    /// Like [`JsArray::from_slice`], the values are staged through a scratch
+    /// `BigUint64Array`, which copies them across the FFI boundary in a
+    /// single memcpy, and converted to an ordinary array by the engine with
+    /// `Array.from`. Building the array costs a constant number of FFI calls
+    /// rather than one `BigInt` creation per element.
+    pub fn from_u64_slice<'cx>(cx: &mut Cx<'cx>, slice: &[u64]) -> JsResult<'cx, JsArray> {
+        let staged = JsBigUint64Array::from_slice(cx, slice)?;
+
+        Self::array_from_staged(cx, staged)
+    }
+
+    /// Constructs an array of `BigInt` elements from a slice of `i64` values.
+    ///
+    /// See [`JsBigInt::from_u64_slice`]; the values are staged through a
+    /// `BigInt64Array` instead.
+    pub fn from_i64_slice<'cx>(cx: &mut Cx<'cx>, slice: &[i64]) -> JsResult<'cx, JsArray> {
+        let staged = JsBigInt64Array::from_slice(cx, slice)?;
+
+        Self::array_from_staged(cx, staged)
+    }
+
+    fn array_from_staged<'cx, V: Value>(
+        cx: &mut Cx<'cx>,
+        staged: Handle<'cx, V>,
+    ) -> JsResult<'cx, JsArray> {
+        cx.global::<JsFunction>("Array")?
+            .get::<JsFunction, _, _>(cx, "from")?
+            .bind(cx)
+            .arg(staged)?
+            .call()
+    }
+
+    /// Reads every element of an array of `BigInt`s as a `u64` in one pass.
+    ///
+    /// The elements are staged through a scratch `BigUint64Array` built by
+    /// the engine with `BigUint64Array.from` and copied out in a single
+    /// memcpy, costing a constant number of FFI calls rather than one read
+    /// per element.
+    ///
+    /// Elements are converted with JavaScript's `ToBigUint64` semantics:
+    /// values outside the `u64` range wrap modulo 2⁶⁴, and elements that are
+    /// not `BigInt`s throw a `TypeError`.
+    pub fn to_u64_vec<'cx>(cx: &mut Cx<'cx>, array: Handle<'cx, JsArray>) -> NeonResult<Vec<u64>> {
+        // `%TypedArray%.from` requires its receiver to be the constructor
+        let constructor = cx.global::<JsFunction>("BigUint64Array")?;
+
+        let staged: Handle<JsBigUint64Array> = constructor
+            .get::<JsFunction, _, _>(cx, "from")?
+            .bind(cx)
+            .this(constructor)?
+            .arg(array)?
+            .call()?;
+
+        Ok(staged.as_slice(cx).to_vec())
+    }
+
+    /// Reads every element of an array of `BigInt`s as an `i64` in one pass.
+    ///
+    /// See [`JsBigInt::to_u64_vec`]; elements are converted with `ToBigInt64`
+    /// semantics, wrapping modulo 2⁶⁴ into the signed range.
+    pub fn to_i64_vec<'cx>(cx: &mut Cx<'cx>, array: Handle<'cx, JsArray>) -> NeonResult<Vec<i64>> {
+        let constructor = cx.global::<JsFunction>("BigInt64Array")?;
+
+        let staged: Handle<JsBigInt64Array> = constructor
+            .get::<JsFunction, _, _>(cx, "from")?
+            .bind(cx)
+            .this(constructor)?
+            .arg(array)?
+            .call()?;
+
+        Ok(staged.as_slice(cx).to_vec())
+    }
 }
 
 impl Value for JsBigInt {}
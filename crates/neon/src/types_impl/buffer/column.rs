@@ -0,0 +1,152 @@
+use crate::{
+    context::Context,
+    result::JsResult,
+    types::{
+        buffer::{types::Binary, TypedArray},
+        JsTypedArray, Value,
+    },
+};
+
+// Number of elements converted per inner-loop iteration. A fixed trip count
+// lets the compiler unroll and vectorize the conversion without a runtime
+// length check per element.
+const LANES: usize = 16;
+
+// Applies `f` element-wise from `src` into `dst`, in `LANES`-wide blocks with
+// a scalar loop for the remainder. Callers guarantee equal lengths.
+#[inline]
+fn cast_blocks<S, D, F>(src: &[S], dst: &mut [D], f: F)
+where
+    S: Copy,
+    D: Copy,
+    F: Fn(S) -> D,
+{
+    debug_assert_eq!(src.len(), dst.len());
+
+    let mut src = src.chunks_exact(LANES);
+    let mut dst = dst.chunks_exact_mut(LANES);
+
+    for (src, dst) in (&mut src).zip(&mut dst) {
+        for i in 0..LANES {
+            dst[i] = f(src[i]);
+        }
+    }
+
+    for (src, dst) in src.remainder().iter().zip(dst.into_remainder()) {
+        *dst = f(*src);
+    }
+}
+
+/// A conversion kernel from one numeric column element type to another.
+///
+/// Implementations convert a whole column in a single pass suitable for
+/// vectorization, rather than converting one element per JavaScript call.
+/// The conversions provided are the ones common when moving columnar data
+/// into typed arrays for consumption by JavaScript:
+///
+/// * `i32` and `i64` widen to `f64` (`i64` values beyond 2<sup>53</sup>
+///   lose precision, as they would in JavaScript)
+/// * `f64` narrows to `f32`
+/// * `u8` normalizes to `f32` in `[0, 1]`
+///
+/// See [`JsTypedArray::from_column`] for the typical entry point.
+pub trait CastColumn<D: Binary>: Binary {
+    /// Converts `src` element-wise into `dst`.
+    ///
+    /// # Panics
+    ///
+    /// Panics if the slices have different lengths.
+    fn cast_column(src: &[Self], dst: &mut [D]);
+}
+
+impl CastColumn<f64> for i32 {
+    fn cast_column(src: &[i32], dst: &mut [f64]) {
+        assert_eq!(src.len(), dst.len());
+        cast_blocks(src, dst, |x| x as f64);
+    }
+}
+
+impl CastColumn<f64> for i64 {
+    fn cast_column(src: &[i64], dst: &mut [f64]) {
+        assert_eq!(src.len(), dst.len());
+        cast_blocks(src, dst, |x| x as f64);
+    }
+}
+
+impl CastColumn<f32> for f64 {
+    fn cast_column(src: &[f64], dst: &mut [f32]) {
+        assert_eq!(src.len(), dst.len());
+        cast_blocks(src, dst, |x| x as f32);
+    }
+}
+
+impl CastColumn<f32> for u8 {
+    fn cast_column(src: &[u8], dst: &mut [f32]) {
+        assert_eq!(src.len(), dst.len());
+        cast_blocks(src, dst, |x| f32::from(x) * (1.0 / 255.0));
+    }
+}
+
+impl<T> JsTypedArray<T>
+where
+    T: Binary,
+    JsTypedArray<T>: Value,
+{
+    /// Constructs an instance by converting a numeric column.
+    ///
+    /// The backing buffer is allocated at the converted size and filled in a
+    /// single pass over the column; no intermediate JavaScript values are
+    /// created. For a copy without conversion, use
+    /// [`from_slice`](JsTypedArray::from_slice) instead.
+    ///
+    /// ```
+    /// # use neon::prelude::*;
+    /// # fn example(mut cx: FunctionContext, samples: &[i32]) -> JsResult<JsTypedArray<f64>> {
+    /// let column = JsTypedArray::<f64>::from_column(&mut cx, samples)?;
+    /// # Ok(column)
+    /// # }
+    /// ```
+    pub fn from_column<'cx, C, S>(cx: &mut C, column: &[S]) -> JsResult<'cx, Self>
+    where
+        C: Context<'cx>,
+        S: CastColumn<T>,
+    {
+        let mut array = Self::new(cx, column.len())?;
+        let target = array.as_mut_slice(cx);
+
+        S::cast_column(column, target);
+
+        Ok(array)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::{cast_blocks, LANES};
+
+    #[test]
+    fn test_cast_blocks_covers_remainder() {
+        // One full block plus a remainder shorter than a block
+        let src = (0..(LANES + 3) as i32).collect::<Vec<_>>();
+        let mut dst = vec![0.0f64; src.len()];
+
+        cast_blocks(&src, &mut dst, |x| x as f64);
+
+        for (src, dst) in src.iter().zip(&dst) {
+            assert_eq!(*dst, f64::from(*src));
+        }
+    }
+
+    #[test]
+    fn test_normalize_kernel() {
+        let src = [0u8, 51, 102, 255];
+        let mut dst = [0.0f32; 4];
+
+        cast_blocks(&src, &mut dst, |x| f32::from(x) * (1.0 / 255.0));
+
+        assert_eq!(dst[0], 0.0);
+        assert_eq!(dst[3], 1.0);
+        assert!((dst[1] - 0.2).abs() < 1e-6);
+        assert!((dst[2] - 0.4).abs() < 1e-6);
+    }
+}
@@ -1,4 +1,4 @@
-use std::{cell::RefCell, ops::Range};
+use std::{cell::RefCell, ops::Range, ptr};
 
 use crate::{
     context::Context,
@@ -28,6 +28,18 @@ where
             ledger: Default::default(),
         }
     }
+
+    /// Constructs a new [`Lock`] with space reserved for at least `capacity`
+    /// concurrent borrows, and locks the VM.
+    ///
+    /// Useful when a large number of borrows will be taken while the lock is
+    /// held, to avoid reallocating the ledger's bookkeeping mid-flight.
+    pub fn with_capacity(cx: &'cx mut C, capacity: usize) -> Lock<'cx, C> {
+        Lock {
+            cx,
+            ledger: RefCell::new(Ledger::with_capacity(capacity)),
+        }
+    }
 }
 
 #[derive(Debug, Default)]
@@ -36,10 +48,10 @@ where
 // Ranges are open on the end: `[start, end)`
 pub(super) struct Ledger {
     // Mutable borrows. Should never overlap with other borrows.
-    pub(super) owned: Vec<Range<*const u8>>,
+    pub(super) owned: IntervalIndex,
 
     // Immutable borrows. May overlap or contain duplicates.
-    pub(super) shared: Vec<Range<*const u8>>,
+    pub(super) shared: IntervalIndex,
 }
 
 impl Ledger {
@@ -52,6 +64,15 @@ impl Ledger {
         (start.cast())..(end.cast())
     }
 
+    // Constructs a ledger that can hold `capacity` borrows of each kind
+    // without reallocating
+    pub(super) fn with_capacity(capacity: usize) -> Self {
+        Ledger {
+            owned: IntervalIndex::with_capacity(capacity),
+            shared: IntervalIndex::with_capacity(capacity),
+        }
+    }
+
     // Dynamically check a slice conforms to borrow rules before returning by
     // using interior mutability of the ledger.
     pub(super) fn try_borrow<'a, T>(
@@ -59,7 +80,12 @@ impl Ledger {
         data: &'a [T],
     ) -> Result<Ref<'a, T>, BorrowError> {
         if !data.is_empty() {
-            ledger.borrow_mut().try_add_borrow(data)?;
+            let result = ledger.borrow_mut().try_add_borrow(data);
+
+            #[cfg(feature = "stats")]
+            crate::meta::counters::ledger_borrow(result.is_ok());
+
+            result?;
         }
 
         Ok(Ref { ledger, data })
@@ -72,7 +98,12 @@ impl Ledger {
         data: &'a mut [T],
     ) -> Result<RefMut<'a, T>, BorrowError> {
         if !data.is_empty() {
-            ledger.borrow_mut().try_add_borrow_mut(data)?;
+            let result = ledger.borrow_mut().try_add_borrow_mut(data);
+
+            #[cfg(feature = "stats")]
+            crate::meta::counters::ledger_borrow(result.is_ok());
+
+            result?;
         }
 
         Ok(RefMut { ledger, data })
@@ -83,10 +114,12 @@ impl Ledger {
         let range = Self::slice_to_range(data);
 
         // Check if the borrow overlaps with any active mutable borrow
-        check_overlap(&self.owned, &range)?;
+        if !self.owned.is_disjoint_from(&range) {
+            return Err(BorrowError::new());
+        }
 
         // Record a record of the immutable borrow
-        self.shared.push(range);
+        self.shared.insert(range);
 
         Ok(())
     }
@@ -95,31 +128,102 @@ impl Ledger {
     fn try_add_borrow_mut<T>(&mut self, data: &mut [T]) -> Result<(), BorrowError> {
         let range = Self::slice_to_range(data);
 
-        // Check if the borrow overlaps with any active mutable borrow
-        check_overlap(&self.owned, &range)?;
-
-        // Check if the borrow overlaps with any active immutable borrow
-        check_overlap(&self.shared, &range)?;
+        // Check if the borrow overlaps with any active borrow
+        if !self.owned.is_disjoint_from(&range) || !self.shared.is_disjoint_from(&range) {
+            return Err(BorrowError::new());
+        }
 
         // Record a record of the mutable borrow
-        self.owned.push(range);
+        self.owned.insert(range);
 
         Ok(())
     }
 }
 
-fn is_disjoint(a: &Range<*const u8>, b: &Range<*const u8>) -> bool {
-    b.start >= a.end || a.start >= b.end
+#[derive(Debug, Default)]
+// Sorted index of byte ranges supporting overlap queries with a single binary
+// search, even when the stored ranges overlap each other.
+pub(super) struct IntervalIndex {
+    // Ranges sorted by `(start, end)`; may contain duplicates
+    ranges: Vec<Range<*const u8>>,
+
+    // `max_ends[i]` is the maximum `end` of `ranges[..=i]`. Because it is a
+    // prefix maximum, the array is non-decreasing; it lets overlap queries
+    // avoid scanning ranges whose `start` is in bounds but whose `end` is not.
+    max_ends: Vec<*const u8>,
 }
 
-fn check_overlap(
-    existing: &[Range<*const u8>],
-    range: &Range<*const u8>,
-) -> Result<(), BorrowError> {
-    if existing.iter().all(|i| is_disjoint(i, range)) {
-        Ok(())
-    } else {
-        Err(BorrowError::new())
+impl IntervalIndex {
+    fn with_capacity(capacity: usize) -> Self {
+        IntervalIndex {
+            ranges: Vec::with_capacity(capacity),
+            max_ends: Vec::with_capacity(capacity),
+        }
+    }
+
+    // `true` if `range` does not overlap any stored range
+    pub(super) fn is_disjoint_from(&self, range: &Range<*const u8>) -> bool {
+        // Candidates for an overlap must begin before `range` ends; the prefix
+        // maximum tells us whether any of them also end after `range` begins.
+        let i = self.ranges.partition_point(|r| r.start < range.end);
+
+        i == 0 || self.max_ends[i - 1] <= range.start
+    }
+
+    // Insert `range`, maintaining the sort order and prefix maximums
+    pub(super) fn insert(&mut self, range: Range<*const u8>) {
+        let i = self.sorted_position(&range);
+        let end = range.end;
+
+        self.ranges.insert(i, range);
+        self.max_ends.insert(i, end);
+        self.recompute_max_ends(i);
+    }
+
+    // Remove a range equal to `range`; panics if no such range is stored
+    pub(super) fn remove(&mut self, range: &Range<*const u8>) {
+        let i = self.sorted_position(range);
+
+        assert!(
+            self.ranges.get(i) == Some(range),
+            "removing a range that was not in the ledger",
+        );
+
+        self.ranges.remove(i);
+        self.max_ends.remove(i);
+        self.recompute_max_ends(i);
+    }
+
+    // Index of the first stored range that does not sort before `range`
+    fn sorted_position(&self, range: &Range<*const u8>) -> usize {
+        self.ranges
+            .partition_point(|r| (r.start, r.end) < (range.start, range.end))
+    }
+
+    // Restore the prefix maximum invariant from position `i` onwards
+    fn recompute_max_ends(&mut self, i: usize) {
+        let mut max = if i == 0 {
+            ptr::null()
+        } else {
+            self.max_ends[i - 1]
+        };
+
+        for (j, (range, max_end)) in self.ranges[i..]
+            .iter()
+            .zip(&mut self.max_ends[i..])
+            .enumerate()
+        {
+            max = max.max(range.end);
+
+            // Past the edited position, an unchanged entry means every later
+            // prefix maximum is unchanged, too. Position `i` itself holds a
+            // placeholder after an insertion, so it is always written.
+            if j > 0 && *max_end == max {
+                break;
+            }
+
+            *max_end = max;
+        }
     }
 }
 
@@ -195,4 +299,70 @@ mod tests {
 
         Ok(())
     }
+
+    #[test]
+    fn test_many_disjoint_borrows() -> Result<(), Box<dyn Error>> {
+        let ledger = RefCell::new(Ledger::with_capacity(64));
+        let mut data = [0u8; 256];
+        let base = data.as_mut_ptr();
+
+        // Mutably borrow every other 4-byte chunk, in a scattered order
+        let chunks = (0..32)
+            .map(|i| ((i * 7) % 32) * 8)
+            .map(|offset| unsafe_aliased_slice(&mut data[offset..offset + 4]))
+            .map(|chunk| Ledger::try_borrow_mut(&ledger, chunk))
+            .collect::<Result<Vec<_>, _>>()?;
+
+        // Every chunk overlaps exactly one active mutable borrow
+        for offset in (0..256).step_by(8) {
+            let chunk = unsafe { slice::from_raw_parts(base.add(offset), 8) };
+
+            assert_eq!(
+                Ledger::try_borrow(&ledger, chunk).unwrap_err(),
+                BorrowError::new(),
+            );
+        }
+
+        // The gaps in between do not overlap any borrow
+        for offset in (4..256).step_by(8) {
+            let chunk = unsafe { slice::from_raw_parts(base.add(offset), 4) };
+
+            Ledger::try_borrow(&ledger, chunk)?;
+        }
+
+        mem::drop(chunks);
+
+        // All mutable borrows were removed
+        let _all = Ledger::try_borrow_mut(&ledger, unsafe_aliased_slice(&mut data))?;
+
+        Ok(())
+    }
+
+    #[test]
+    fn test_nested_shared_borrows() -> Result<(), Box<dyn Error>> {
+        let ledger = RefCell::new(Ledger::default());
+        let mut data = [0u8; 64];
+        let all = unsafe_aliased_slice(&mut data);
+        let head = unsafe_aliased_slice(&mut data[0..8]);
+        let tail = unsafe_aliased_slice(&mut data[48..64]);
+
+        // Nested ranges sort by start, but a borrow starting early may end
+        // late; the index must still find it when checking a mutable borrow.
+        let outer = Ledger::try_borrow(&ledger, all)?;
+        let inner = Ledger::try_borrow(&ledger, head)?;
+
+        mem::drop(inner);
+
+        // Should fail because the outer borrow is still active
+        assert_eq!(
+            Ledger::try_borrow_mut(&ledger, tail).unwrap_err(),
+            BorrowError::new(),
+        );
+
+        mem::drop(outer);
+
+        let _tail = Ledger::try_borrow_mut(&ledger, tail)?;
+
+        Ok(())
+    }
 }
@@ -0,0 +1,87 @@
+use std::{fs::File, io, ops::Range, os::unix::io::AsRawFd, ptr, slice};
+
+// A private (copy-on-write) memory mapping of a file region.
+//
+// Used as the externally allocated storage of a `JsArrayBuffer`, so that the
+// buffer's finalizer unmaps the region instead of freeing heap memory. The
+// mapping is never shared; writes through the buffer only touch the mapped
+// pages, not the file.
+pub(super) struct MmapFile {
+    // Page-aligned mapping; null iff the requested region is empty
+    map: *mut libc::c_void,
+    map_len: usize,
+
+    // Location of the requested region within the mapping, since the region
+    // may begin at an arbitrary (unaligned) file offset
+    offset: usize,
+    len: usize,
+}
+
+// Safety: the mapping is exclusively owned and valid on every thread
+unsafe impl Send for MmapFile {}
+
+impl MmapFile {
+    // Maps `range` (in bytes) of `file` into memory
+    pub(super) fn open(file: &File, range: Range<u64>) -> io::Result<Self> {
+        let len = usize::try_from(range.end - range.start)
+            .map_err(|_| io::Error::from(io::ErrorKind::InvalidInput))?;
+
+        if len == 0 {
+            return Ok(MmapFile {
+                map: ptr::null_mut(),
+                map_len: 0,
+                offset: 0,
+                len: 0,
+            });
+        }
+
+        // `mmap` requires a page-aligned file offset; map from the containing
+        // page boundary and remember where the requested region begins
+        let page = unsafe { libc::sysconf(libc::_SC_PAGESIZE) } as u64;
+        let aligned = (range.start / page) * page;
+        let offset = (range.start - aligned) as usize;
+        let map_len = offset + len;
+
+        let map = unsafe {
+            libc::mmap(
+                ptr::null_mut(),
+                map_len,
+                libc::PROT_READ | libc::PROT_WRITE,
+                libc::MAP_PRIVATE,
+                file.as_raw_fd(),
+                aligned as libc::off_t,
+            )
+        };
+
+        if map == libc::MAP_FAILED {
+            return Err(io::Error::last_os_error());
+        }
+
+        Ok(MmapFile {
+            map,
+            map_len,
+            offset,
+            len,
+        })
+    }
+}
+
+impl AsMut<[u8]> for MmapFile {
+    fn as_mut(&mut self) -> &mut [u8] {
+        if self.len == 0 {
+            &mut []
+        } else {
+            unsafe { slice::from_raw_parts_mut(self.map.cast::<u8>().add(self.offset), self.len) }
+        }
+    }
+}
+
+impl Drop for MmapFile {
+    fn drop(&mut self) {
+        if !self.map.is_null() {
+            unsafe {
+                libc::munmap(self.map, self.map_len);
+            }
+        }
+    }
+}
@@ -18,9 +18,18 @@ use crate::{
     },
 };
 
+mod column;
 pub(crate) mod lock;
+#[cfg(all(unix, feature = "external-buffers"))]
+pub(super) mod mmap;
+#[cfg(feature = "external-buffers")]
+mod pool;
 pub(super) mod types;
 
+pub use column::CastColumn;
+#[cfg(feature = "external-buffers")]
+#[cfg_attr(docsrs, doc(cfg(feature = "external-buffers")))]
+pub use pool::Pool;
 pub use types::Binary;
 
 /// A trait allowing Rust to borrow binary data from the memory buffer of JavaScript
@@ -144,9 +153,8 @@ impl<'a, T> Drop for Ref<'a, T> {
 
         let mut ledger = self.ledger.borrow_mut();
         let range = Ledger::slice_to_range(self.data);
-        let i = ledger.shared.iter().rposition(|r| r == &range).unwrap();
 
-        ledger.shared.remove(i);
+        ledger.shared.remove(&range);
     }
 }
 
@@ -158,9 +166,8 @@ impl<'a, T> Drop for RefMut<'a, T> {
 
         let mut ledger = self.ledger.borrow_mut();
         let range = Ledger::slice_to_range(self.data);
-        let i = ledger.owned.iter().rposition(|r| r == &range).unwrap();
 
-        ledger.owned.remove(i);
+        ledger.owned.remove(&range);
     }
 }
 
@@ -0,0 +1,220 @@
+use std::{
+    mem,
+    sync::{Arc, Mutex, Weak},
+};
+
+use crate::{context::Context, handle::Handle, types::JsBuffer};
+
+// Size classes are powers of two from `1 << MIN_SHIFT` bytes up to
+// `1 << MAX_SHIFT` bytes; larger (or empty) requests bypass the pool.
+const MIN_SHIFT: u32 = 6;
+const MAX_SHIFT: u32 = 24;
+const NUM_CLASSES: usize = (MAX_SHIFT - MIN_SHIFT + 1) as usize;
+
+// Retained allocations per size class before recycled memory is released
+const DEFAULT_MAX_RETAINED: usize = 32;
+
+/// A pool of recycled backing allocations for [`JsBuffer`]s.
+///
+/// Every [`JsBuffer::new`] allocates fresh backing storage and hands it to the
+/// garbage collector when the buffer dies. Workloads that create and discard
+/// many short-lived buffers can instead [`take`](Pool::take) buffers from a
+/// pool; when such a buffer is collected, its backing memory is returned to
+/// the pool and reused by a later `take` instead of being freed.
+///
+/// Allocations are grouped into power-of-two size classes. A buffer taken
+/// from the pool has exactly the requested length and is zero-filled, whether
+/// its storage is fresh or recycled. Requests too large for the largest size
+/// class are served with one-shot allocations that are not recycled.
+///
+/// The pool may be cloned cheaply; clones share the same storage. Dropping
+/// every clone frees the retained memory, while buffers still alive keep
+/// their own storage and release it to the allocator when collected.
+///
+/// # Example
+///
+/// ```
+/// # #[cfg(feature = "external-buffers")]
+/// # {
+/// # use neon::prelude::*;
+/// use neon::types::buffer::Pool;
+///
+/// fn chunk(mut cx: FunctionContext, pool: &Pool) -> JsResult<JsBuffer> {
+///     let len = cx.argument::<JsNumber>(0)?.value(&mut cx) as usize;
+///
+///     Ok(pool.take(&mut cx, len))
+/// }
+/// # }
+/// ```
+///
+/// # Compatibility Note
+///
+/// Pooled buffers are backed by externally allocated memory and share the
+/// sandboxed pointer incompatibility of [`JsBuffer::external`], so this API
+/// is also gated by the **`external-buffers`** feature flag.
+#[derive(Clone, Debug)]
+pub struct Pool {
+    inner: Arc<PoolInner>,
+}
+
+impl Pool {
+    /// Constructs an empty pool that retains up to a small fixed number of
+    /// allocations per size class.
+    pub fn new() -> Self {
+        Self::with_max_retained(DEFAULT_MAX_RETAINED)
+    }
+
+    /// Constructs an empty pool that retains up to `max_retained` recycled
+    /// allocations per size class; excess allocations are freed when the
+    /// buffers backed by them are collected.
+    pub fn with_max_retained(max_retained: usize) -> Self {
+        Pool {
+            inner: Arc::new(PoolInner {
+                max_retained,
+                classes: std::array::from_fn(|_| Mutex::new(Vec::new())),
+            }),
+        }
+    }
+
+    /// Takes a zero-filled buffer of length `len` from the pool, recycling a
+    /// retained allocation if one is available.
+    ///
+    /// The buffer's backing memory is returned to the pool when the buffer is
+    /// garbage collected.
+    pub fn take<'a, C: Context<'a>>(&self, cx: &mut C, len: usize) -> Handle<'a, JsBuffer> {
+        let data = self.inner.take_storage(len);
+
+        JsBuffer::external(
+            cx,
+            PooledSlice {
+                data,
+                len,
+                pool: Arc::downgrade(&self.inner),
+            },
+        )
+    }
+}
+
+impl Default for Pool {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+#[derive(Debug)]
+struct PoolInner {
+    max_retained: usize,
+    classes: [Mutex<Vec<Vec<u8>>>; NUM_CLASSES],
+}
+
+impl PoolInner {
+    // Size class for a request of `len` bytes, if it is poolable
+    fn class_of(len: usize) -> Option<usize> {
+        if len == 0 || len > (1 << MAX_SHIFT) {
+            return None;
+        }
+
+        let shift = len.next_power_of_two().trailing_zeros().max(MIN_SHIFT);
+
+        Some((shift - MIN_SHIFT) as usize)
+    }
+
+    // Pops a recycled allocation of the class covering `len`, or allocates a
+    // fresh one; the result is always zeroed over its full class size
+    fn take_storage(&self, len: usize) -> Vec<u8> {
+        let Some(class) = Self::class_of(len) else {
+            return vec![0; len];
+        };
+
+        let recycled = self.classes[class].lock().unwrap().pop();
+
+        match recycled {
+            Some(mut data) => {
+                data.fill(0);
+                data
+            }
+            None => vec![0; 1 << (class as u32 + MIN_SHIFT)],
+        }
+    }
+
+    // Returns an allocation to its size class, unless the class is full
+    fn recycle(&self, data: Vec<u8>) {
+        if let Some(class) = Self::class_of(data.len()) {
+            let mut retained = self.classes[class].lock().unwrap();
+
+            if retained.len() < self.max_retained {
+                retained.push(data);
+            }
+        }
+    }
+}
+
+// Backing storage of a pooled buffer. The buffer exposes only the requested
+// prefix of the (class-sized) allocation; the finalizer hands the allocation
+// back to the pool if the pool is still alive.
+struct PooledSlice {
+    data: Vec<u8>,
+    len: usize,
+    pool: Weak<PoolInner>,
+}
+
+impl AsMut<[u8]> for PooledSlice {
+    fn as_mut(&mut self) -> &mut [u8] {
+        &mut self.data[..self.len]
+    }
+}
+
+impl Drop for PooledSlice {
+    fn drop(&mut self) {
+        if let Some(pool) = self.pool.upgrade() {
+            pool.recycle(mem::take(&mut self.data));
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::{PoolInner, MAX_SHIFT, NUM_CLASSES};
+
+    #[test]
+    fn test_size_classes() {
+        assert_eq!(PoolInner::class_of(0), None);
+        assert_eq!(PoolInner::class_of(1), Some(0));
+        assert_eq!(PoolInner::class_of(64), Some(0));
+        assert_eq!(PoolInner::class_of(65), Some(1));
+        assert_eq!(PoolInner::class_of(64 * 1024), Some(10));
+        assert_eq!(PoolInner::class_of(1 << MAX_SHIFT), Some(NUM_CLASSES - 1));
+        assert_eq!(PoolInner::class_of((1 << MAX_SHIFT) + 1), None);
+    }
+
+    #[test]
+    fn test_storage_is_recycled_and_zeroed() {
+        let pool = super::Pool::with_max_retained(1).inner;
+        let mut data = pool.take_storage(100);
+
+        assert_eq!(data.len(), 128);
+
+        let ptr = data.as_ptr();
+        data.fill(0xff);
+        pool.recycle(data);
+
+        // Same class: the dirtied allocation comes back, zeroed
+        let data = pool.take_storage(65);
+        assert_eq!(data.as_ptr(), ptr);
+        assert!(data.iter().all(|&b| b == 0));
+
+        // The class is capped at one retained allocation
+        pool.recycle(data);
+        pool.recycle(vec![0xff; 128]);
+        assert_eq!(pool.classes[1].lock().unwrap().len(), 1);
+
+        // Oversized requests bypass the pool
+        let large = pool.take_storage((1 << MAX_SHIFT) + 1);
+        pool.recycle(large);
+        assert!(pool
+            .classes
+            .iter()
+            .skip(2)
+            .all(|c| c.lock().unwrap().is_empty()));
+    }
+}
@@ -291,6 +291,62 @@ impl JsArrayBuffer {
         Handle::new_internal(Self(value))
     }
 
+    #[cfg(all(unix, feature = "external-buffers"))]
+    #[cfg_attr(docsrs, doc(cfg(all(unix, feature = "external-buffers"))))]
+    /// Constructs a `JsArrayBuffer` backed by a memory-mapped region of a file.
+    ///
+    /// The file contents are not copied through an intermediate heap buffer;
+    /// pages are faulted in on demand by the operating system, making this
+    /// suitable for exposing very large files to JavaScript. The mapping is
+    /// private (copy-on-write), so writes to the buffer from JavaScript or
+    /// Rust do not modify the file. The region is unmapped when the
+    /// `ArrayBuffer` is garbage collected.
+    ///
+    /// Maps the byte range `range` of the file, or the entire file if `range`
+    /// is [`None`]. Throws an exception if the file cannot be opened, the
+    /// range does not fit within the file, or the mapping fails.
+    ///
+    /// Typed views of the mapped data can be created with the usual
+    /// [`region`](Handle::region) and [`JsTypedArray::from_buffer`] APIs.
+    ///
+    /// # Compatibility Note
+    ///
+    /// This method is built on [`JsArrayBuffer::external`] and shares its
+    /// incompatibility with environments that enable V8's sandboxed pointers,
+    /// so it is also gated by the **`external-buffers`** feature flag.
+    pub fn mmap<'a, C, P>(
+        cx: &mut C,
+        path: P,
+        range: Option<std::ops::Range<u64>>,
+    ) -> JsResult<'a, Self>
+    where
+        C: Context<'a>,
+        P: AsRef<std::path::Path>,
+    {
+        use crate::types_impl::buffer::mmap::MmapFile;
+
+        let file =
+            std::fs::File::open(path.as_ref()).or_else(|err| cx.throw_error(err.to_string()))?;
+
+        let len = file
+            .metadata()
+            .or_else(|err| cx.throw_error(err.to_string()))?
+            .len();
+
+        let range = range.unwrap_or(0..len);
+
+        if range.start > range.end || range.end > len {
+            return cx.throw_range_error(format!(
+                "byte range {}..{} is out of bounds for a file of {len} bytes",
+                range.start, range.end,
+            ));
+        }
+
+        let map = MmapFile::open(&file, range).or_else(|err| cx.throw_error(err.to_string()))?;
+
+        Ok(Self::external(cx, map))
+    }
+
     /// Returns a region of this buffer.
     ///
     /// See also: [`Handle<JsArrayBuffer>::region()`](Handle::region) for a more
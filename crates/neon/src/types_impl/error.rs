@@ -113,6 +113,123 @@ impl JsError {
     }
 }
 
+// The class of error a template materializes
+#[cfg(feature = "napi-6")]
+#[derive(Copy, Clone)]
+enum Kind {
+    Error,
+    TypeError,
+    RangeError,
+}
+
+/// A pre-materialized JavaScript error for high-frequency throw paths.
+///
+/// Every call to [`Context::throw_error`] builds a fresh message string and a
+/// fresh `Error` object, including a stack capture by the engine. On a hot
+/// rejection path that throws one of a fixed set of messages -- input
+/// validation, for example -- that construction cost dominates.
+///
+/// An `ErrorTemplate` creates and [roots](crate::handle::Root) its error
+/// object once per JavaScript thread on first use; subsequent throws load the
+/// rooted object and throw it, performing no allocation and no stack capture.
+/// The stack is captured once, when the template is first materialized;
+/// [`without_stack`](Self::without_stack) removes even that, since a
+/// creation-time stack is rarely meaningful for a reused error.
+///
+/// Because the same object is thrown every time, callers should treat it as
+/// frozen: properties added by one catcher are visible to the next, and the
+/// `stack` does not describe the throwing call site.
+///
+/// # Example
+///
+/// ```
+/// # use neon::prelude::*;
+/// # use neon::types::ErrorTemplate;
+/// static NOT_A_NUMBER: ErrorTemplate =
+///     ErrorTemplate::type_error("expected a number").without_stack();
+///
+/// fn validate(mut cx: FunctionContext) -> JsResult<JsNumber> {
+///     let n: Handle<JsValue> = cx.argument(0)?;
+///
+///     match n.downcast::<JsNumber, _>(&mut cx) {
+///         Ok(n) => Ok(n),
+///         Err(_) => NOT_A_NUMBER.throw(&mut cx),
+///     }
+/// }
+/// ```
+#[cfg(feature = "napi-6")]
+#[cfg_attr(docsrs, doc(cfg(feature = "napi-6")))]
+pub struct ErrorTemplate {
+    kind: Kind,
+    message: &'static str,
+    stack: bool,
+    cached: crate::thread::LocalKey<crate::handle::Root<JsError>>,
+}
+
+#[cfg(feature = "napi-6")]
+impl ErrorTemplate {
+    /// Creates a template for an instance of the `Error` class. This method
+    /// is `const`, so it can be assigned to static variables.
+    pub const fn error(message: &'static str) -> Self {
+        Self::new(Kind::Error, message)
+    }
+
+    /// Creates a template for an instance of the `TypeError` class.
+    pub const fn type_error(message: &'static str) -> Self {
+        Self::new(Kind::TypeError, message)
+    }
+
+    /// Creates a template for an instance of the `RangeError` class.
+    pub const fn range_error(message: &'static str) -> Self {
+        Self::new(Kind::RangeError, message)
+    }
+
+    const fn new(kind: Kind, message: &'static str) -> Self {
+        Self {
+            kind,
+            message,
+            stack: true,
+            cached: crate::thread::LocalKey::new(),
+        }
+    }
+
+    /// Removes the `stack` captured when the template's error is first
+    /// materialized, leaving the property `undefined`.
+    pub const fn without_stack(mut self) -> Self {
+        self.stack = false;
+        self
+    }
+
+    /// Gets the pre-materialized error, creating and rooting it if this is
+    /// the first use on the current JavaScript thread.
+    pub fn create<'a, C: Context<'a>>(&self, cx: &mut C) -> NeonResult<Handle<'a, JsError>> {
+        let root = self.cached.get_or_try_init(cx, |cx| {
+            let err = match self.kind {
+                Kind::Error => JsError::error(cx, self.message)?,
+                Kind::TypeError => JsError::type_error(cx, self.message)?,
+                Kind::RangeError => JsError::range_error(cx, self.message)?,
+            };
+
+            if !self.stack {
+                let undefined = cx.undefined();
+
+                err.set(cx, "stack", undefined)?;
+            }
+
+            Ok(err.root(cx))
+        })?;
+
+        Ok(root.to_inner(cx))
+    }
+
+    /// Throws the pre-materialized error in the current context.
+    pub fn throw<'a, C: Context<'a>, T>(&self, cx: &mut C) -> NeonResult<T> {
+        let err = self.create(cx)?;
+
+        cx.throw(err)
+    }
+}
+
 pub(crate) fn convert_panics<T, F: UnwindSafe + FnOnce() -> NeonResult<T>>(
     env: Env,
     f: F,
@@ -3,7 +3,7 @@ use crate::{
     handle::Handle,
     result::{JsResult, NeonResult},
     types::{
-        extract::{private, TryFromJs, TryIntoJs, TypeExpected},
+        extract::{TryFromJs, TryIntoJs, TypeExpected},
         Finalize, JsBox, JsValue,
     },
 };
@@ -71,5 +71,3 @@ where
         Ok(cx.boxed(self.0))
     }
 }
-
-impl<T> private::Sealed for Boxed<T> {}
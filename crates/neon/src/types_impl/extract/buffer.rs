@@ -4,7 +4,7 @@ use crate::{
     result::{JsResult, NeonResult},
     types::{
         buffer::{Binary, TypedArray},
-        extract::{private, TryFromJs, TryIntoJs, TypeExpected},
+        extract::{TryFromJs, TryIntoJs, TypeExpected},
         JsArrayBuffer, JsBigInt64Array, JsBigUint64Array, JsBuffer, JsFloat32Array, JsFloat64Array,
         JsInt16Array, JsInt32Array, JsInt8Array, JsTypedArray, JsUint16Array, JsUint32Array,
         JsUint8Array, JsValue, Value,
@@ -44,8 +44,6 @@ where
     }
 }
 
-impl<B> private::Sealed for ArrayBuffer<B> {}
-
 /// Wrapper for converting between bytes and [`JsBuffer`](JsBuffer)
 pub struct Buffer<B>(pub B);
 
@@ -79,8 +77,6 @@ where
     }
 }
 
-impl<B> private::Sealed for Buffer<B> {}
-
 impl<'cx, T> TryIntoJs<'cx> for Vec<T>
 where
     JsTypedArray<T>: Value,
@@ -113,13 +109,6 @@ where
     }
 }
 
-impl<T> private::Sealed for Vec<T>
-where
-    JsTypedArray<T>: Value,
-    T: Binary,
-{
-}
-
 impl<'cx, T, const N: usize> TryIntoJs<'cx> for [T; N]
 where
     JsTypedArray<T>: Value,
@@ -132,13 +121,6 @@ where
     }
 }
 
-impl<T, const N: usize> private::Sealed for [T; N]
-where
-    JsTypedArray<T>: Value,
-    T: Binary,
-{
-}
-
 impl<'cx, T> TryIntoJs<'cx> for &[T]
 where
     JsTypedArray<T>: Value,
@@ -151,13 +133,6 @@ where
     }
 }
 
-impl<T> private::Sealed for &[T]
-where
-    JsTypedArray<T>: Value,
-    T: Binary,
-{
-}
-
 macro_rules! typed_array {
     ($js:ident, $name:ident, $type:ty) => {
         #[doc = concat!(
@@ -198,8 +173,6 @@ macro_rules! typed_array {
                 Ok(Ok(Self(T::from(v.as_slice(cx)))))
             }
         }
-
-        impl<T> private::Sealed for $name<T> {}
     };
 
     ($(($js:ident, $name:ident, $type:ty),)*) => {
@@ -0,0 +1,847 @@
+//! Extract JavaScript values with direct serde (de)serialization
+//!
+//! Where the [`Json`](super::Json) extractor round-trips values through
+//! `JSON.stringify` and `JSON.parse` — materializing the whole payload as an
+//! intermediate string on both sides of the boundary — the [`Direct`]
+//! extractor walks JavaScript values with a serde `Serializer` and
+//! `Deserializer` implemented straight over the Node-API getters and
+//! setters. No intermediate string is ever created, which makes it
+//! significantly faster for large payloads.
+//!
+//! ```
+//! use neon::types::extract::Direct;
+//!
+//! #[neon::export]
+//! fn sort(Direct(mut strings): Direct<Vec<String>>) -> Direct<Vec<String>> {
+//!     strings.sort();
+//!     Direct(strings)
+//! }
+//! ```
+
+use std::{error, fmt};
+
+use serde::{de, ser, Serialize};
+
+use crate::{
+    context::{internal::ContextInternal, Context, Cx},
+    handle::Handle,
+    object::{props, Object},
+    result::{JsResult, NeonResult, Throw},
+    sys,
+    types::{
+        buffer::TypedArray,
+        extract::{TryFromJs, TryIntoJs},
+        private::ValueInternal,
+        JsArray, JsArrayBuffer, JsError, JsObject, JsString, JsUint8Array, JsValue, Value,
+    },
+};
+
+/// Wrapper for converting between `T` and [`JsValue`](crate::types::JsValue)
+/// by (de)serializing directly, without an intermediate JSON string.
+pub struct Direct<T>(pub T);
+
+impl<'cx, T> TryFromJs<'cx> for Direct<T>
+where
+    for<'de> T: serde::Deserialize<'de>,
+{
+    type Error = Error;
+
+    fn try_from_js(
+        cx: &mut Cx<'cx>,
+        v: Handle<'cx, JsValue>,
+    ) -> NeonResult<Result<Self, Self::Error>> {
+        match T::deserialize(Deserializer { cx, value: v }) {
+            Ok(v) => Ok(Ok(Direct(v))),
+            Err(DirectError::Custom(msg)) => Ok(Err(Error(msg))),
+            Err(DirectError::Throw(throw)) => Err(throw),
+        }
+    }
+}
+
+impl<'cx, T> TryIntoJs<'cx> for Direct<T>
+where
+    T: serde::Serialize,
+{
+    type Value = JsValue;
+
+    fn try_into_js(self, cx: &mut Cx<'cx>) -> JsResult<'cx, Self::Value> {
+        match self.0.serialize(Serializer { cx }) {
+            Ok(v) => Ok(v),
+            Err(DirectError::Custom(msg)) => cx.throw_error(msg),
+            Err(DirectError::Throw(throw)) => Err(throw),
+        }
+    }
+}
+
+/// Error returned when a value cannot be directly (de)serialized
+pub struct Error(String);
+
+impl fmt::Display for Error {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        fmt::Display::fmt(&self.0, f)
+    }
+}
+
+impl fmt::Debug for Error {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        fmt::Debug::fmt(&self.0, f)
+    }
+}
+
+impl error::Error for Error {}
+
+impl<'cx> TryIntoJs<'cx> for Error {
+    type Value = JsError;
+
+    fn try_into_js(self, cx: &mut Cx<'cx>) -> JsResult<'cx, Self::Value> {
+        JsError::error(cx, self.to_string())
+    }
+}
+
+// Internal error type threaded through the serde implementations. A pending
+// JavaScript exception is carried alongside serde's own custom errors so that
+// it can be re-surfaced as a `Throw` instead of being stringified.
+enum DirectError {
+    Custom(String),
+    Throw(Throw),
+}
+
+impl From<Throw> for DirectError {
+    fn from(throw: Throw) -> Self {
+        DirectError::Throw(throw)
+    }
+}
+
+impl fmt::Display for DirectError {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        match self {
+            DirectError::Custom(msg) => f.write_str(msg),
+            DirectError::Throw(throw) => fmt::Display::fmt(throw, f),
+        }
+    }
+}
+
+impl fmt::Debug for DirectError {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        fmt::Display::fmt(self, f)
+    }
+}
+
+impl error::Error for DirectError {}
+
+impl ser::Error for DirectError {
+    fn custom<T: fmt::Display>(msg: T) -> Self {
+        DirectError::Custom(msg.to_string())
+    }
+}
+
+impl de::Error for DirectError {
+    fn custom<T: fmt::Display>(msg: T) -> Self {
+        DirectError::Custom(msg.to_string())
+    }
+}
+
+type DirectResult<T> = Result<T, DirectError>;
+
+fn value_type(cx: &mut Cx, v: Handle<JsValue>) -> DirectResult<sys::ValueType> {
+    let mut ty = sys::ValueType::Object;
+
+    unsafe {
+        match sys::typeof_value(cx.env().to_raw(), v.to_local(), &mut ty) {
+            Err(sys::Status::PendingException) => return Err(Throw::new().into()),
+            status => status.unwrap(),
+        };
+    }
+
+    Ok(ty)
+}
+
+// Commits staged property descriptors to `object` with a single batched call
+fn commit(
+    cx: &mut Cx,
+    object: Handle<JsObject>,
+    descriptors: &props::private::DescriptorsVec,
+) -> DirectResult<()> {
+    unsafe {
+        match sys::object::define_properties(cx.env().to_raw(), object.to_local(), descriptors) {
+            Ok(()) => Ok(()),
+            Err(sys::Status::PendingException) => Err(Throw::new().into()),
+            _ => Err(ser::Error::custom("failed to define properties")),
+        }
+    }
+}
+
+struct Serializer<'a, 'cx> {
+    cx: &'a mut Cx<'cx>,
+}
+
+impl<'a, 'cx> Serializer<'a, 'cx> {
+    fn number(self, v: f64) -> DirectResult<Handle<'cx, JsValue>> {
+        Ok(self.cx.number(v).upcast())
+    }
+
+    // Wraps an externally tagged variant value as `{ variant: value }`
+    fn variant(
+        cx: &mut Cx<'cx>,
+        variant: &'static str,
+        value: Handle<'cx, JsValue>,
+    ) -> DirectResult<Handle<'cx, JsValue>> {
+        let object = cx.empty_object();
+
+        object.set(cx, variant, value)?;
+
+        Ok(object.upcast())
+    }
+}
+
+impl<'a, 'cx> ser::Serializer for Serializer<'a, 'cx> {
+    type Ok = Handle<'cx, JsValue>;
+    type Error = DirectError;
+
+    type SerializeSeq = SerializeVec<'a, 'cx>;
+    type SerializeTuple = SerializeVec<'a, 'cx>;
+    type SerializeTupleStruct = SerializeVec<'a, 'cx>;
+    type SerializeTupleVariant = SerializeVariant<SerializeVec<'a, 'cx>>;
+    type SerializeMap = SerializeObject<'a, 'cx>;
+    type SerializeStruct = SerializeObject<'a, 'cx>;
+    type SerializeStructVariant = SerializeVariant<SerializeObject<'a, 'cx>>;
+
+    fn serialize_bool(self, v: bool) -> DirectResult<Self::Ok> {
+        Ok(self.cx.boolean(v).upcast())
+    }
+
+    fn serialize_i8(self, v: i8) -> DirectResult<Self::Ok> {
+        self.number(v as f64)
+    }
+
+    fn serialize_i16(self, v: i16) -> DirectResult<Self::Ok> {
+        self.number(v as f64)
+    }
+
+    fn serialize_i32(self, v: i32) -> DirectResult<Self::Ok> {
+        self.number(v as f64)
+    }
+
+    fn serialize_i64(self, v: i64) -> DirectResult<Self::Ok> {
+        self.number(v as f64)
+    }
+
+    fn serialize_u8(self, v: u8) -> DirectResult<Self::Ok> {
+        self.number(v as f64)
+    }
+
+    fn serialize_u16(self, v: u16) -> DirectResult<Self::Ok> {
+        self.number(v as f64)
+    }
+
+    fn serialize_u32(self, v: u32) -> DirectResult<Self::Ok> {
+        self.number(v as f64)
+    }
+
+    fn serialize_u64(self, v: u64) -> DirectResult<Self::Ok> {
+        self.number(v as f64)
+    }
+
+    fn serialize_f32(self, v: f32) -> DirectResult<Self::Ok> {
+        self.number(v as f64)
+    }
+
+    fn serialize_f64(self, v: f64) -> DirectResult<Self::Ok> {
+        self.number(v)
+    }
+
+    fn serialize_char(self, v: char) -> DirectResult<Self::Ok> {
+        Ok(self.cx.string(v.to_string()).upcast())
+    }
+
+    fn serialize_str(self, v: &str) -> DirectResult<Self::Ok> {
+        Ok(self.cx.string(v).upcast())
+    }
+
+    fn serialize_bytes(self, v: &[u8]) -> DirectResult<Self::Ok> {
+        Ok(JsUint8Array::from_slice(self.cx, v)?.upcast())
+    }
+
+    fn serialize_none(self) -> DirectResult<Self::Ok> {
+        Ok(self.cx.null().upcast())
+    }
+
+    fn serialize_some<T: ?Sized + Serialize>(self, value: &T) -> DirectResult<Self::Ok> {
+        value.serialize(self)
+    }
+
+    fn serialize_unit(self) -> DirectResult<Self::Ok> {
+        Ok(self.cx.null().upcast())
+    }
+
+    fn serialize_unit_struct(self, _name: &'static str) -> DirectResult<Self::Ok> {
+        self.serialize_unit()
+    }
+
+    fn serialize_unit_variant(
+        self,
+        _name: &'static str,
+        _variant_index: u32,
+        variant: &'static str,
+    ) -> DirectResult<Self::Ok> {
+        Ok(self.cx.string(variant).upcast())
+    }
+
+    fn serialize_newtype_struct<T: ?Sized + Serialize>(
+        self,
+        _name: &'static str,
+        value: &T,
+    ) -> DirectResult<Self::Ok> {
+        value.serialize(self)
+    }
+
+    fn serialize_newtype_variant<T: ?Sized + Serialize>(
+        self,
+        _name: &'static str,
+        _variant_index: u32,
+        variant: &'static str,
+        value: &T,
+    ) -> DirectResult<Self::Ok> {
+        let value = value.serialize(Serializer { cx: &mut *self.cx })?;
+
+        Self::variant(self.cx, variant, value)
+    }
+
+    fn serialize_seq(self, _len: Option<usize>) -> DirectResult<Self::SerializeSeq> {
+        let array = self.cx.empty_array();
+
+        Ok(SerializeVec {
+            cx: self.cx,
+            array,
+            len: 0,
+        })
+    }
+
+    fn serialize_tuple(self, len: usize) -> DirectResult<Self::SerializeTuple> {
+        self.serialize_seq(Some(len))
+    }
+
+    fn serialize_tuple_struct(
+        self,
+        _name: &'static str,
+        len: usize,
+    ) -> DirectResult<Self::SerializeTupleStruct> {
+        self.serialize_seq(Some(len))
+    }
+
+    fn serialize_tuple_variant(
+        self,
+        name: &'static str,
+        _variant_index: u32,
+        variant: &'static str,
+        len: usize,
+    ) -> DirectResult<Self::SerializeTupleVariant> {
+        Ok(SerializeVariant {
+            variant,
+            inner: Serializer { cx: self.cx }.serialize_tuple_struct(name, len)?,
+        })
+    }
+
+    fn serialize_map(self, _len: Option<usize>) -> DirectResult<Self::SerializeMap> {
+        let object = self.cx.empty_object();
+
+        Ok(SerializeObject {
+            cx: self.cx,
+            object,
+            descriptors: props::private::DescriptorsVec::new(),
+            key: None,
+        })
+    }
+
+    fn serialize_struct(
+        self,
+        _name: &'static str,
+        len: usize,
+    ) -> DirectResult<Self::SerializeStruct> {
+        self.serialize_map(Some(len))
+    }
+
+    fn serialize_struct_variant(
+        self,
+        name: &'static str,
+        _variant_index: u32,
+        variant: &'static str,
+        len: usize,
+    ) -> DirectResult<Self::SerializeStructVariant> {
+        Ok(SerializeVariant {
+            variant,
+            inner: Serializer { cx: self.cx }.serialize_struct(name, len)?,
+        })
+    }
+}
+
+struct SerializeVec<'a, 'cx> {
+    cx: &'a mut Cx<'cx>,
+    array: Handle<'cx, JsArray>,
+    len: u32,
+}
+
+impl<'a, 'cx> SerializeVec<'a, 'cx> {
+    fn push<T: ?Sized + Serialize>(&mut self, value: &T) -> DirectResult<()> {
+        let value = value.serialize(Serializer { cx: &mut *self.cx })?;
+        let index = self.len;
+
+        self.len += 1;
+        self.array.set(self.cx, index, value)?;
+
+        Ok(())
+    }
+}
+
+impl<'a, 'cx> ser::SerializeSeq for SerializeVec<'a, 'cx> {
+    type Ok = Handle<'cx, JsValue>;
+    type Error = DirectError;
+
+    fn serialize_element<T: ?Sized + Serialize>(&mut self, value: &T) -> DirectResult<()> {
+        self.push(value)
+    }
+
+    fn end(self) -> DirectResult<Self::Ok> {
+        Ok(self.array.upcast())
+    }
+}
+
+impl<'a, 'cx> ser::SerializeTuple for SerializeVec<'a, 'cx> {
+    type Ok = Handle<'cx, JsValue>;
+    type Error = DirectError;
+
+    fn serialize_element<T: ?Sized + Serialize>(&mut self, value: &T) -> DirectResult<()> {
+        self.push(value)
+    }
+
+    fn end(self) -> DirectResult<Self::Ok> {
+        Ok(self.array.upcast())
+    }
+}
+
+impl<'a, 'cx> ser::SerializeTupleStruct for SerializeVec<'a, 'cx> {
+    type Ok = Handle<'cx, JsValue>;
+    type Error = DirectError;
+
+    fn serialize_field<T: ?Sized + Serialize>(&mut self, value: &T) -> DirectResult<()> {
+        self.push(value)
+    }
+
+    fn end(self) -> DirectResult<Self::Ok> {
+        Ok(self.array.upcast())
+    }
+}
+
+// Serializes map entries and struct fields by staging property descriptors
+// and committing them to the object with a single batched call on `end`
+struct SerializeObject<'a, 'cx> {
+    cx: &'a mut Cx<'cx>,
+    object: Handle<'cx, JsObject>,
+    descriptors: props::private::DescriptorsVec,
+    key: Option<Handle<'cx, JsString>>,
+}
+
+impl<'a, 'cx> ser::SerializeMap for SerializeObject<'a, 'cx> {
+    type Ok = Handle<'cx, JsValue>;
+    type Error = DirectError;
+
+    fn serialize_key<T: ?Sized + Serialize>(&mut self, key: &T) -> DirectResult<()> {
+        let key = key.serialize(Serializer { cx: &mut *self.cx })?;
+
+        // Coerce non-string keys (e.g. numbers) to property names
+        self.key = Some(key.to_string(self.cx)?);
+
+        Ok(())
+    }
+
+    fn serialize_value<T: ?Sized + Serialize>(&mut self, value: &T) -> DirectResult<()> {
+        let key = self.key.take().expect("serialize_value called before key");
+        let value = value.serialize(Serializer { cx: &mut *self.cx })?;
+
+        self.descriptors
+            .push(props::descriptor(key.to_local(), value.to_local()));
+
+        Ok(())
+    }
+
+    fn end(self) -> DirectResult<Self::Ok> {
+        commit(self.cx, self.object, &self.descriptors)?;
+
+        Ok(self.object.upcast())
+    }
+}
+
+impl<'a, 'cx> ser::SerializeStruct for SerializeObject<'a, 'cx> {
+    type Ok = Handle<'cx, JsValue>;
+    type Error = DirectError;
+
+    fn serialize_field<T: ?Sized + Serialize>(
+        &mut self,
+        key: &'static str,
+        value: &T,
+    ) -> DirectResult<()> {
+        let key = self.cx.string(key);
+        let value = value.serialize(Serializer { cx: &mut *self.cx })?;
+
+        self.descriptors
+            .push(props::descriptor(key.to_local(), value.to_local()));
+
+        Ok(())
+    }
+
+    fn end(self) -> DirectResult<Self::Ok> {
+        commit(self.cx, self.object, &self.descriptors)?;
+
+        Ok(self.object.upcast())
+    }
+}
+
+// Wraps a sequence or object serializer, tagging the finished value as
+// `{ variant: value }`
+struct SerializeVariant<S> {
+    variant: &'static str,
+    inner: S,
+}
+
+impl<'a, 'cx> ser::SerializeTupleVariant for SerializeVariant<SerializeVec<'a, 'cx>> {
+    type Ok = Handle<'cx, JsValue>;
+    type Error = DirectError;
+
+    fn serialize_field<T: ?Sized + Serialize>(&mut self, value: &T) -> DirectResult<()> {
+        self.inner.push(value)
+    }
+
+    fn end(self) -> DirectResult<Self::Ok> {
+        let value = self.inner.array.upcast();
+
+        Serializer::variant(self.inner.cx, self.variant, value)
+    }
+}
+
+impl<'a, 'cx> ser::SerializeStructVariant for SerializeVariant<SerializeObject<'a, 'cx>> {
+    type Ok = Handle<'cx, JsValue>;
+    type Error = DirectError;
+
+    fn serialize_field<T: ?Sized + Serialize>(
+        &mut self,
+        key: &'static str,
+        value: &T,
+    ) -> DirectResult<()> {
+        ser::SerializeStruct::serialize_field(&mut self.inner, key, value)
+    }
+
+    fn end(self) -> DirectResult<Self::Ok> {
+        commit(self.inner.cx, self.inner.object, &self.inner.descriptors)?;
+
+        let value = self.inner.object.upcast();
+
+        Serializer::variant(self.inner.cx, self.variant, value)
+    }
+}
+
+struct Deserializer<'a, 'cx> {
+    cx: &'a mut Cx<'cx>,
+    value: Handle<'cx, JsValue>,
+}
+
+impl<'de, 'a, 'cx> de::Deserializer<'de> for Deserializer<'a, 'cx> {
+    type Error = DirectError;
+
+    fn deserialize_any<V>(self, visitor: V) -> DirectResult<V::Value>
+    where
+        V: de::Visitor<'de>,
+    {
+        match value_type(self.cx, self.value)? {
+            sys::ValueType::Undefined | sys::ValueType::Null => visitor.visit_unit(),
+            sys::ValueType::Boolean => visitor.visit_bool(bool::from_js(self.cx, self.value)?),
+            sys::ValueType::Number => {
+                let n = f64::from_js(self.cx, self.value)?;
+
+                // serde's integer impls reject `visit_f64`, so integral
+                // values are dispatched through the integer visitors; the
+                // floating-point impls convert those back losslessly
+                if n.fract() == 0.0 && n >= i64::MIN as f64 && n < i64::MAX as f64 {
+                    visitor.visit_i64(n as i64)
+                } else if n.fract() == 0.0 && n >= 0.0 && n < u64::MAX as f64 {
+                    visitor.visit_u64(n as u64)
+                } else {
+                    visitor.visit_f64(n)
+                }
+            }
+            sys::ValueType::String => visitor.visit_string(String::from_js(self.cx, self.value)?),
+            sys::ValueType::Object => {
+                if let Ok(array) = self.value.downcast::<JsArray, _>(self.cx) {
+                    let len = array.len(self.cx);
+
+                    visitor.visit_seq(SeqAccess {
+                        cx: self.cx,
+                        array,
+                        index: 0,
+                        len,
+                    })
+                } else {
+                    let object = self.value.downcast_or_throw::<JsObject, _>(self.cx)?;
+
+                    visitor.visit_map(MapAccess::new(self.cx, object)?)
+                }
+            }
+            ty => Err(de::Error::custom(format!(
+                "cannot deserialize from a JavaScript {ty:?}"
+            ))),
+        }
+    }
+
+    fn deserialize_option<V>(self, visitor: V) -> DirectResult<V::Value>
+    where
+        V: de::Visitor<'de>,
+    {
+        match value_type(self.cx, self.value)? {
+            sys::ValueType::Undefined | sys::ValueType::Null => visitor.visit_none(),
+            _ => visitor.visit_some(self),
+        }
+    }
+
+    fn deserialize_bytes<V>(self, visitor: V) -> DirectResult<V::Value>
+    where
+        V: de::Visitor<'de>,
+    {
+        self.deserialize_byte_buf(visitor)
+    }
+
+    fn deserialize_byte_buf<V>(self, visitor: V) -> DirectResult<V::Value>
+    where
+        V: de::Visitor<'de>,
+    {
+        if let Ok(buf) = self.value.downcast::<JsUint8Array, _>(self.cx) {
+            return visitor.visit_byte_buf(buf.as_slice(self.cx).to_vec());
+        }
+
+        if let Ok(buf) = self.value.downcast::<JsArrayBuffer, _>(self.cx) {
+            return visitor.visit_byte_buf(buf.as_slice(self.cx).to_vec());
+        }
+
+        self.deserialize_any(visitor)
+    }
+
+    fn deserialize_enum<V>(
+        self,
+        _name: &'static str,
+        _variants: &'static [&'static str],
+        visitor: V,
+    ) -> DirectResult<V::Value>
+    where
+        V: de::Visitor<'de>,
+    {
+        // Externally tagged representation: a bare string is a unit variant
+        // and `{ variant: value }` carries a payload
+        let (variant, value) = match value_type(self.cx, self.value)? {
+            sys::ValueType::String => (String::from_js(self.cx, self.value)?, None),
+            sys::ValueType::Object => {
+                let object = self.value.downcast_or_throw::<JsObject, _>(self.cx)?;
+                let keys = object.get_own_property_names(self.cx)?.to_vec(self.cx)?;
+
+                let [key] = keys[..] else {
+                    return Err(de::Error::custom(
+                        "expected an object with a single variant key",
+                    ));
+                };
+
+                let variant = key
+                    .downcast_or_throw::<JsString, _>(self.cx)?
+                    .value(self.cx);
+                let value = object.get(self.cx, key)?;
+
+                (variant, Some(value))
+            }
+            ty => {
+                return Err(de::Error::custom(format!(
+                    "cannot deserialize an enum from a JavaScript {ty:?}"
+                )))
+            }
+        };
+
+        visitor.visit_enum(EnumAccess {
+            cx: self.cx,
+            variant,
+            value,
+        })
+    }
+
+    serde::forward_to_deserialize_any! {
+        bool i8 i16 i32 i64 i128 u8 u16 u32 u64 u128 f32 f64 char str string
+        unit unit_struct newtype_struct seq tuple tuple_struct map struct
+        identifier ignored_any
+    }
+}
+
+struct SeqAccess<'a, 'cx> {
+    cx: &'a mut Cx<'cx>,
+    array: Handle<'cx, JsArray>,
+    index: u32,
+    len: u32,
+}
+
+impl<'de, 'a, 'cx> de::SeqAccess<'de> for SeqAccess<'a, 'cx> {
+    type Error = DirectError;
+
+    fn next_element_seed<T>(&mut self, seed: T) -> DirectResult<Option<T::Value>>
+    where
+        T: de::DeserializeSeed<'de>,
+    {
+        if self.index >= self.len {
+            return Ok(None);
+        }
+
+        let value: Handle<JsValue> = self.array.get(self.cx, self.index)?;
+
+        self.index += 1;
+
+        seed.deserialize(Deserializer {
+            cx: &mut *self.cx,
+            value,
+        })
+        .map(Some)
+    }
+
+    fn size_hint(&self) -> Option<usize> {
+        Some((self.len - self.index) as usize)
+    }
+}
+
+struct MapAccess<'a, 'cx> {
+    cx: &'a mut Cx<'cx>,
+    object: Handle<'cx, JsObject>,
+    keys: Vec<Handle<'cx, JsValue>>,
+    index: usize,
+}
+
+impl<'a, 'cx> MapAccess<'a, 'cx> {
+    fn new(cx: &'a mut Cx<'cx>, object: Handle<'cx, JsObject>) -> NeonResult<Self> {
+        let keys = object.get_own_property_names(cx)?.to_vec(cx)?;
+
+        Ok(Self {
+            cx,
+            object,
+            keys,
+            index: 0,
+        })
+    }
+}
+
+impl<'de, 'a, 'cx> de::MapAccess<'de> for MapAccess<'a, 'cx> {
+    type Error = DirectError;
+
+    fn next_key_seed<K>(&mut self, seed: K) -> DirectResult<Option<K::Value>>
+    where
+        K: de::DeserializeSeed<'de>,
+    {
+        let Some(key) = self.keys.get(self.index) else {
+            return Ok(None);
+        };
+
+        seed.deserialize(Deserializer {
+            cx: &mut *self.cx,
+            value: *key,
+        })
+        .map(Some)
+    }
+
+    fn next_value_seed<V>(&mut self, seed: V) -> DirectResult<V::Value>
+    where
+        V: de::DeserializeSeed<'de>,
+    {
+        let key = self.keys[self.index];
+
+        self.index += 1;
+
+        let value: Handle<JsValue> = self.object.get(self.cx, key)?;
+
+        seed.deserialize(Deserializer {
+            cx: &mut *self.cx,
+            value,
+        })
+    }
+
+    fn size_hint(&self) -> Option<usize> {
+        Some(self.keys.len() - self.index)
+    }
+}
+
+struct EnumAccess<'a, 'cx> {
+    cx: &'a mut Cx<'cx>,
+    variant: String,
+    value: Option<Handle<'cx, JsValue>>,
+}
+
+impl<'de, 'a, 'cx> de::EnumAccess<'de> for EnumAccess<'a, 'cx> {
+    type Error = DirectError;
+    type Variant = VariantAccess<'a, 'cx>;
+
+    fn variant_seed<V>(self, seed: V) -> DirectResult<(V::Value, Self::Variant)>
+    where
+        V: de::DeserializeSeed<'de>,
+    {
+        use serde::de::IntoDeserializer;
+
+        let variant: de::value::StringDeserializer<DirectError> = self.variant.into_deserializer();
+        let variant = seed.deserialize(variant)?;
+
+        Ok((
+            variant,
+            VariantAccess {
+                cx: self.cx,
+                value: self.value,
+            },
+        ))
+    }
+}
+
+struct VariantAccess<'a, 'cx> {
+    cx: &'a mut Cx<'cx>,
+    value: Option<Handle<'cx, JsValue>>,
+}
+
+impl<'de, 'a, 'cx> de::VariantAccess<'de> for VariantAccess<'a, 'cx> {
+    type Error = DirectError;
+
+    fn unit_variant(self) -> DirectResult<()> {
+        Ok(())
+    }
+
+    fn newtype_variant_seed<T>(self, seed: T) -> DirectResult<T::Value>
+    where
+        T: de::DeserializeSeed<'de>,
+    {
+        let value = self
+            .value
+            .ok_or_else(|| DirectError::Custom("expected a payload for the newtype variant".to_string()))?;
+
+        seed.deserialize(Deserializer { cx: self.cx, value })
+    }
+
+    fn tuple_variant<V>(self, _len: usize, visitor: V) -> DirectResult<V::Value>
+    where
+        V: de::Visitor<'de>,
+    {
+        let value = self
+            .value
+            .ok_or_else(|| DirectError::Custom("expected a payload for the tuple variant".to_string()))?;
+
+        de::Deserializer::deserialize_any(Deserializer { cx: self.cx, value }, visitor)
+    }
+
+    fn struct_variant<V>(
+        self,
+        _fields: &'static [&'static str],
+        visitor: V,
+    ) -> DirectResult<V::Value>
+    where
+        V: de::Visitor<'de>,
+    {
+        let value = self
+            .value
+            .ok_or_else(|| DirectError::Custom("expected a payload for the struct variant".to_string()))?;
+
+        de::Deserializer::deserialize_any(Deserializer { cx: self.cx, value }, visitor)
+    }
+}
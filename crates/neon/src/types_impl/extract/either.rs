@@ -8,7 +8,7 @@ use crate::{
     object::Object,
     result::{JsResult, NeonResult},
     types::{
-        extract::{private, TryFromJs, TryIntoJs},
+        extract::{TryFromJs, TryIntoJs},
         JsError, JsValue,
     },
 };
@@ -53,8 +53,6 @@ where
     }
 }
 
-impl<L, R> private::Sealed for Either<L, R> {}
-
 #[derive(Debug)]
 pub struct Error<L, R> {
     left: (&'static str, L),
@@ -111,5 +109,3 @@ where
         Ok(err)
     }
 }
-
-impl<L, R> private::Sealed for Error<L, R> {}
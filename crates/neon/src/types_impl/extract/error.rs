@@ -3,10 +3,7 @@ use std::{convert::Infallible, error, fmt, marker::PhantomData};
 use crate::{
     context::{Context, Cx},
     result::JsResult,
-    types::{
-        extract::{private, TryIntoJs},
-        JsError, JsValue, Value,
-    },
+    types::{extract::TryIntoJs, JsError, JsValue, Value},
 };
 
 type BoxError = Box<dyn error::Error + Send + Sync + 'static>;
@@ -15,7 +12,7 @@ type BoxError = Box<dyn error::Error + Send + Sync + 'static>;
 pub struct TypeExpected<T: Value>(PhantomData<T>);
 
 impl<T: Value> TypeExpected<T> {
-    pub(super) fn new() -> Self {
+    pub(crate) fn new() -> Self {
         Self(PhantomData)
     }
 }
@@ -42,8 +39,6 @@ impl<'cx, T: Value> TryIntoJs<'cx> for TypeExpected<T> {
     }
 }
 
-impl<T: Value> private::Sealed for TypeExpected<T> {}
-
 impl<'cx> TryIntoJs<'cx> for Infallible {
     type Value = JsValue;
 
@@ -52,8 +47,6 @@ impl<'cx> TryIntoJs<'cx> for Infallible {
     }
 }
 
-impl private::Sealed for Infallible {}
-
 #[derive(Debug)]
 /// Error that implements [`TryIntoJs`] and can produce specific error types.
 ///
@@ -22,7 +22,7 @@ use crate::{
     object::Object,
     result::{JsResult, NeonResult},
     types::{
-        extract::{private, TryFromJs, TryIntoJs},
+        extract::{TryFromJs, TryIntoJs},
         JsError, JsFunction, JsObject, JsString, JsValue,
     },
 };
@@ -116,8 +116,6 @@ where
     }
 }
 
-impl<T> private::Sealed for Json<T> {}
-
 /// Error returned when a value is invalid JSON
 pub struct Error(serde_json::Error);
 
@@ -142,5 +140,3 @@ impl<'cx> TryIntoJs<'cx> for Error {
         JsError::error(cx, self.to_string())
     }
 }
-
-impl private::Sealed for Error {}
@@ -106,6 +106,8 @@ use crate::{
     types::{JsValue, Value},
 };
 
+pub use neon_macros::{TryFromJs, TryIntoJs};
+
 pub use self::{
     boxed::Boxed,
     buffer::{
@@ -118,7 +120,11 @@ pub use self::{
 
 #[cfg(feature = "serde")]
 #[cfg_attr(docsrs, doc(cfg(feature = "serde")))]
-pub use self::json::Json;
+pub use self::{direct::Direct, json::Json};
+
+#[cfg(feature = "serde")]
+#[cfg_attr(docsrs, doc(cfg(feature = "serde")))]
+pub mod direct;
 
 #[cfg(feature = "serde")]
 #[cfg_attr(docsrs, doc(cfg(feature = "serde")))]
@@ -135,9 +141,14 @@ mod try_into_js;
 mod with;
 
 /// Extract Rust data from a JavaScript value
+///
+/// This trait can be derived for structs with named fields; the generated
+/// implementation reads each field from an object property of the same name,
+/// using interned [`Key`](crate::object::Key)s so that repeated extractions
+/// do not re-create the key strings.
 pub trait TryFromJs<'cx>
 where
-    Self: private::Sealed + Sized,
+    Self: Sized,
 {
     type Error: TryIntoJs<'cx>;
 
@@ -161,9 +172,11 @@ where
 }
 
 /// Convert Rust data into a JavaScript value
+///
+/// This trait can be derived for structs with named fields; the generated
+/// implementation writes all of the fields to a new object with a single
+/// batched property-definition call.
 pub trait TryIntoJs<'cx>
-where
-    Self: private::Sealed,
 {
     /// The type of JavaScript value that will be created
     type Value: Value;
@@ -47,5 +47,3 @@ where
         (self.0)(cx).try_into_js(cx)
     }
 }
-
-impl<F, O> super::private::Sealed for With<F, O> where for<'cx> F: FnOnce(&mut Cx<'cx>) -> O {}
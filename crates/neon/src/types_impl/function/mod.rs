@@ -1,15 +1,18 @@
 //! Types and traits for working with JavaScript functions.
 
-use smallvec::smallvec;
+use std::mem::MaybeUninit;
+
+use smallvec::{smallvec, SmallVec};
 
 use crate::{
-    context::{Context, Cx},
-    handle::Handle,
+    context::{internal::ContextInternal, Context, Cx},
+    handle::{Handle, Root},
     object::Object,
     result::{JsResult, NeonResult},
+    sys::{self, raw},
     types::{
         extract::{TryFromJs, TryIntoJs, With},
-        private::ValueInternal,
+        private::{check_call_status, ValueInternal},
         JsFunction, JsObject, JsValue, Value,
     },
 };
@@ -103,6 +106,135 @@ impl<'a, 'cx: 'a> BindOptions<'a, 'cx> {
     }
 }
 
+/// A reusable, pre-bound function call for invoking the same callback many
+/// times.
+///
+/// Where [`JsFunction::bind`] builds a fresh [`BindOptions`] — and a fresh
+/// argument buffer — on every call, a `PreparedCall` is created once from a
+/// rooted callee and a fixed `this`, and owns an argument buffer that is
+/// reused across invocations. Per call, the cost is one reference lookup for
+/// the callee (and `this`, if any), the argument writes, and the single
+/// `napi_call_function`.
+///
+/// ```
+/// # use neon::prelude::*;
+/// # use neon::types::function::PreparedCall;
+/// # fn foo(mut cx: FunctionContext) -> JsResult<JsUndefined> {
+/// let f = cx.argument::<JsFunction>(0)?.root(&mut cx);
+/// let mut call = PreparedCall::new(f, None);
+///
+/// for row in 0..1000 {
+///     call.bind(&mut cx).arg(row as f64)?.exec()?;
+/// }
+/// # Ok(cx.undefined())
+/// # }
+/// ```
+pub struct PreparedCall {
+    callee: Root<JsFunction>,
+    this: Option<Root<JsObject>>,
+    // Raw argument buffer, reused across calls to keep its capacity; the
+    // values written to it are only valid within a single `bind` session.
+    args: SmallVec<[raw::Local; 8]>,
+}
+
+impl PreparedCall {
+    /// Prepares a call to `callee`, invoked with `this` (or `undefined` if
+    /// `None`).
+    pub fn new(callee: Root<JsFunction>, this: Option<Root<JsObject>>) -> Self {
+        Self {
+            callee,
+            this,
+            args: SmallVec::new(),
+        }
+    }
+
+    /// Starts a call, clearing the argument buffer.
+    ///
+    /// # Panics
+    ///
+    /// Panics if called from a different JavaScript thread than the one in
+    /// which the callee was rooted.
+    pub fn bind<'a, 'cx>(&'a mut self, cx: &'a mut Cx<'cx>) -> PreparedBind<'a, 'cx> {
+        let callee = self.callee.to_inner(cx).to_local();
+        let this = match &self.this {
+            Some(this) => this.to_inner(cx).to_local(),
+            None => cx.undefined().to_local(),
+        };
+
+        self.args.clear();
+
+        PreparedBind {
+            cx,
+            callee,
+            this,
+            args: &mut self.args,
+        }
+    }
+
+    /// Recovers the rooted callee and `this`, allowing them to be properly
+    /// disposed of with [`Root::drop`] or [`Root::into_inner`].
+    pub fn into_parts(self) -> (Root<JsFunction>, Option<Root<JsObject>>) {
+        (self.callee, self.this)
+    }
+}
+
+/// A single invocation of a [`PreparedCall`], mirroring the [`BindOptions`]
+/// builder methods.
+pub struct PreparedBind<'a, 'cx: 'a> {
+    cx: &'a mut Cx<'cx>,
+    callee: raw::Local,
+    this: raw::Local,
+    args: &'a mut SmallVec<[raw::Local; 8]>,
+}
+
+impl<'a, 'cx: 'a> PreparedBind<'a, 'cx> {
+    /// Add an argument to the arguments list.
+    pub fn arg<A: TryIntoJs<'cx>>(&mut self, a: A) -> NeonResult<&mut Self> {
+        let v = a.try_into_js(self.cx)?;
+        self.args.push(v.to_local());
+        Ok(self)
+    }
+
+    /// Replaces the arguments list with the given arguments.
+    pub fn args<A: TryIntoArguments<'cx>>(&mut self, a: A) -> NeonResult<&mut Self> {
+        let args = a.try_into_args_vec(self.cx)?;
+        self.args.clear();
+        self.args.extend(args.iter().map(|v| v.to_local()));
+        Ok(self)
+    }
+
+    /// Make the function call. If the function returns without throwing, the
+    /// result value is converted to a Rust value with `TryFromJs::from_js`.
+    pub fn call<R: TryFromJs<'cx>>(&mut self) -> NeonResult<R> {
+        let env = self.cx.env();
+        let mut result: MaybeUninit<raw::Local> = MaybeUninit::zeroed();
+
+        let status = unsafe {
+            sys::call_function(
+                env.to_raw(),
+                self.this,
+                self.callee,
+                self.args.len(),
+                self.args.as_ptr(),
+                result.as_mut_ptr(),
+            )
+        };
+
+        unsafe { check_call_status(self.cx, self.callee, status)? };
+
+        let v: Handle<JsValue> =
+            Handle::new_internal(unsafe { JsValue::from_local(env, result.assume_init()) });
+
+        R::from_js(self.cx, v)
+    }
+
+    /// Make the function call for side effect, discarding the result value.
+    pub fn exec(&mut self) -> NeonResult<()> {
+        let _ignore: Handle<JsValue> = self.call()?;
+        Ok(())
+    }
+}
+
 /// A builder for making a JavaScript function call like `parseInt("42")`.
 ///
 /// The builder methods make it convenient to assemble the call from parts:
@@ -36,6 +36,7 @@ use crate::{
     result::{JsResult, NeonResult, ResultExt, Throw},
     sys::{self, raw},
     types::{
+        buffer::TypedArray,
         function::{BindOptions, CallOptions, ConstructOptions},
         private::ValueInternal,
         utf8::Utf8,
@@ -53,6 +54,14 @@ pub use self::{
     promise::{Deferred, JsPromise},
 };
 
+#[cfg(feature = "napi-4")]
+#[cfg_attr(docsrs, doc(cfg(feature = "napi-4")))]
+pub use self::promise::DeferredBatch;
+
+#[cfg(feature = "napi-6")]
+#[cfg_attr(docsrs, doc(cfg(feature = "napi-6")))]
+pub use self::error::ErrorTemplate;
+
 #[cfg(feature = "napi-5")]
 pub use self::date::{DateError, DateErrorKind, JsDate};
 
@@ -561,6 +570,104 @@ impl JsString {
         }
     }
 
+    /// Copies the contents of this JavaScript string into an existing Rust
+    /// [`String`], reusing its allocation, and returns the number of bytes
+    /// written.
+    ///
+    /// Any previous contents of `out` are cleared. When the buffer's capacity
+    /// is already large enough to hold the string, the copy is performed with
+    /// a single one-shot call, skipping the length pre-query that
+    /// [`value()`](JsString::value) performs.
+    ///
+    /// This method is useful for avoiding per-call allocations when extracting
+    /// many strings in a hot loop:
+    ///
+    /// ```rust
+    /// # use neon::prelude::*;
+    /// fn print_strings(mut cx: FunctionContext) -> JsResult<JsUndefined> {
+    ///     let strings = cx.argument::<JsArray>(0)?.to_vec(&mut cx)?;
+    ///     let mut buf = String::new();
+    ///
+    ///     for s in strings {
+    ///         let s = s.downcast_or_throw::<JsString, _>(&mut cx)?;
+    ///         s.value_into(&mut cx, &mut buf);
+    ///         println!("JavaScript string contents: {}", buf);
+    ///     }
+    ///
+    ///     Ok(cx.undefined())
+    /// }
+    /// ```
+    pub fn value_into<'a, C: Context<'a>>(&self, cx: &mut C, out: &mut String) -> usize {
+        let env = cx.env().to_raw();
+
+        out.clear();
+
+        unsafe {
+            // Safety: The buffer is only ever filled with valid UTF-8 produced
+            // by the JavaScript engine.
+            let buf = out.as_mut_vec();
+            let capacity = buf.capacity();
+
+            let mut len = if capacity > 0 {
+                sys::string::data(env, buf.as_mut_ptr(), capacity, self.to_local())
+            } else {
+                0
+            };
+
+            // The copy writes only complete UTF-8 sequences, so a truncated
+            // result can stop up to 3 bytes short of `capacity - 1` (plus a
+            // NUL terminator). Only a copy ending clear of that margin is
+            // guaranteed complete; otherwise, fall back to the length query
+            // to distinguish a tight fit from a truncation.
+            if capacity == 0 || len + 4 >= capacity {
+                let size = sys::string::utf8_len(env, self.to_local());
+
+                if size != len {
+                    buf.reserve(size + 1);
+                    len = sys::string::data(env, buf.as_mut_ptr(), size + 1, self.to_local());
+                }
+            }
+
+            buf.set_len(len);
+
+            len
+        }
+    }
+
+    /// Copies the contents of this JavaScript string into a caller-provided
+    /// buffer as UTF-8 with a single one-shot call, skipping the length
+    /// pre-query that [`value()`](JsString::value) performs.
+    ///
+    /// Returns the number of bytes written, or `None` if the buffer is too
+    /// small to hold the whole string (including a NUL terminator); in that
+    /// case the contents of `buf` are unspecified. The required size can be
+    /// determined with [`size()`](JsString::size).
+    pub fn value_to_slice<'a, C: Context<'a>>(&self, cx: &mut C, buf: &mut [u8]) -> Option<usize> {
+        let env = cx.env().to_raw();
+
+        unsafe {
+            if buf.is_empty() {
+                return if sys::string::utf8_len(env, self.to_local()) == 0 {
+                    Some(0)
+                } else {
+                    None
+                };
+            }
+
+            let len = sys::string::data(env, buf.as_mut_ptr(), buf.len(), self.to_local());
+
+            // The copy writes only complete UTF-8 sequences, so a truncated
+            // result can stop up to 3 bytes short of `buf.len() - 1` (plus a
+            // NUL terminator); a result within that margin needs the length
+            // query to disambiguate a tight fit from a truncation.
+            if len + 4 >= buf.len() && sys::string::utf8_len(env, self.to_local()) != len {
+                return None;
+            }
+
+            Some(len)
+        }
+    }
+
     /// Convert this JavaScript string into a [`Vec<u16>`] encoded as UTF-16.
     ///
     /// The returned vector is guaranteed to be valid UTF-16, so libraries that handle
@@ -664,6 +771,60 @@ impl JsString {
         }
     }
 
+    /// Creates a new `JsString` value from a Rust string without copying its
+    /// contents onto the JavaScript heap, by transferring ownership of the
+    /// Rust allocation to the garbage collector.
+    ///
+    /// ASCII strings are shared with the engine byte for byte. Other strings
+    /// are re-encoded as UTF-16 in a single pass, which still avoids a copy
+    /// onto the JavaScript heap. On runtimes without external string support,
+    /// this method falls back to copying, like [`JsString::new`].
+    ///
+    /// Because the engine may hold on to the buffer indefinitely, this method
+    /// is best suited for large strings, where the cost of the copy dominates.
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// # use neon::prelude::*;
+    /// # fn string_external(mut cx: FunctionContext) -> JsResult<JsString> {
+    /// let contents = "hello node".repeat(4096);
+    /// let str = JsString::external(&mut cx, contents);
+    /// # Ok(str)
+    /// # }
+    /// ```
+    #[cfg(feature = "napi-8")]
+    #[cfg_attr(docsrs, doc(cfg(feature = "napi-8")))]
+    pub fn external<'a, C: Context<'a>, S: Into<String>>(
+        cx: &mut C,
+        val: S,
+    ) -> Handle<'a, JsString> {
+        let val = val.into();
+
+        if !sys::string::has_external_strings() {
+            return JsString::new(cx, val);
+        }
+
+        let env = cx.env();
+
+        unsafe {
+            let mut local: raw::Local = std::mem::zeroed();
+
+            // The Latin-1 and UTF-8 encodings coincide exactly on the ASCII
+            // range, so ASCII contents can be handed to the engine directly.
+            let ok = if val.is_ascii() {
+                sys::string::new_external_latin1(&mut local, env.to_raw(), val.into_bytes())
+            } else {
+                let utf16 = val.encode_utf16().collect::<Vec<u16>>();
+                sys::string::new_external_utf16(&mut local, env.to_raw(), utf16)
+            };
+
+            assert!(ok, "failed to create external string");
+
+            Handle::new_internal(JsString(local))
+        }
+    }
+
     pub(crate) fn new_internal<'a>(env: Env, val: &str) -> Option<Handle<'a, JsString>> {
         let (ptr, len) = if let Some(small) = Utf8::from(val).into_small() {
             small.lower()
@@ -881,6 +1042,62 @@ impl JsArray {
         }
     }
 
+    /// Constructs a new array from a slice of numbers.
+    ///
+    /// The elements are staged through a scratch `Float64Array`, which copies
+    /// them across the FFI boundary in a single memcpy, and converted to an
+    /// ordinary array by the engine with `Array.from`. Building the array
+    /// costs a constant number of FFI calls rather than one per element,
+    /// which is significantly faster for large slices.
+    pub fn from_slice<'a>(cx: &mut Cx<'a>, slice: &[f64]) -> JsResult<'a, JsArray> {
+        let staged = JsFloat64Array::from_slice(cx, slice)?;
+
+        cx.global::<JsFunction>("Array")?
+            .get::<JsFunction, _, _>(cx, "from")?
+            .bind(cx)
+            .arg(staged)?
+            .call()
+    }
+
+    /// Constructs a new array from an iterator of numbers.
+    ///
+    /// The elements are buffered in a [`Vec`] and transferred with
+    /// [`JsArray::from_slice`].
+    pub fn from_iter<'a, I>(cx: &mut Cx<'a>, iter: I) -> JsResult<'a, JsArray>
+    where
+        I: IntoIterator,
+        I::Item: Into<f64>,
+    {
+        let values = iter.into_iter().map(Into::into).collect::<Vec<f64>>();
+
+        JsArray::from_slice(cx, &values)
+    }
+
+    /// Copies the contents of the array into a new `Vec<f64>`, coercing each
+    /// element to a number.
+    ///
+    /// The elements are staged through a scratch `Float64Array` built by the
+    /// engine with `Float64Array.from`, so the array crosses the FFI boundary
+    /// in a constant number of calls rather than one per element. Elements
+    /// that do not coerce to a number are read as `NaN`, following typed
+    /// array conversion semantics.
+    pub fn to_vec_numbers<'a>(&self, cx: &mut Cx<'a>) -> NeonResult<Vec<f64>> {
+        let this: Handle<JsArray> =
+            Handle::new_internal(unsafe { ValueInternal::from_local(cx.env(), self.to_local()) });
+
+        // `%TypedArray%.from` requires its receiver to be the constructor
+        let constructor = cx.global::<JsFunction>("Float64Array")?;
+
+        let staged: Handle<JsFloat64Array> = constructor
+            .get::<JsFunction, _, _>(cx, "from")?
+            .bind(cx)
+            .this(constructor)?
+            .arg(this)?
+            .call()?;
+
+        Ok(staged.as_slice(cx).to_vec())
+    }
+
     /// Copies the array contents into a new [`Vec`] by iterating through all indices
     /// from 0 to `self.len()`.
     ///
@@ -1081,6 +1298,44 @@ impl JsFunction {
         Self::new_internal(cx, f, name)
     }
 
+    /// Returns a new `JsFunction` implemented by `f` without the
+    /// `catch_unwind` panic boundary. A panic in `f` unwinds into the
+    /// `extern "C"` trampoline and aborts the process, so this is reserved
+    /// for macro-generated callers that explicitly opt in.
+    pub(crate) fn with_name_abort_unwind<'a, C, F, V>(
+        cx: &mut C,
+        name: &str,
+        f: F,
+    ) -> JsResult<'a, JsFunction>
+    where
+        C: Context<'a>,
+        F: Fn(FunctionContext) -> JsResult<V> + 'static,
+        V: Value,
+    {
+        use std::ptr;
+
+        use crate::context::CallbackInfo;
+
+        let f = move |env: raw::Env, info| {
+            let env = env.into();
+            let info = unsafe { CallbackInfo::new(info) };
+
+            FunctionContext::with(env, &info, |cx| {
+                f(cx)
+                    .map(|v| v.to_local())
+                    .unwrap_or_else(|_: Throw| ptr::null_mut())
+            })
+        };
+
+        unsafe {
+            if let Ok(raw) = sys::fun::new(cx.env().to_raw(), name, f) {
+                Ok(Handle::new_internal(JsFunction { raw }))
+            } else {
+                Err(Throw::new())
+            }
+        }
+    }
+
     fn new_internal<'a, C, F, V>(cx: &mut C, f: F, name: &str) -> JsResult<'a, JsFunction>
     where
         C: Context<'a>,
@@ -112,7 +112,7 @@ pub trait ValueInternal: TransparentNoCopyWrapper + 'static {
     }
 }
 
-unsafe fn check_call_status<'a, C: Context<'a>>(
+pub(crate) unsafe fn check_call_status<'a, C: Context<'a>>(
     cx: &mut C,
     callee: raw::Local,
     status: Result<(), sys::Status>,
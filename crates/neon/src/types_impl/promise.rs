@@ -16,29 +16,32 @@ use crate::{
 use crate::{
     context::Cx,
     event::{Channel, JoinHandle, SendError},
+    types::JsValue,
 };
 
-#[cfg(feature = "napi-6")]
-use crate::{
-    lifecycle::{DropData, InstanceData},
-    sys::tsfn::ThreadsafeFunction,
+#[cfg(feature = "napi-4")]
+use std::{
+    fmt, mem,
+    sync::{
+        atomic::{AtomicBool, Ordering},
+        Arc, Mutex,
+    },
 };
 
+#[cfg(feature = "napi-6")]
+use crate::lifecycle::{DropData, DropQueue, InstanceData};
+
 #[cfg(all(feature = "napi-5", feature = "futures"))]
 use {
     crate::event::{JoinError, SendThrow},
     crate::result::NeonResult,
-    crate::types::{JsFunction, JsValue},
+    crate::types::JsFunction,
     std::future::Future,
     std::pin::Pin,
-    std::sync::Mutex,
     std::task::{self, Poll},
     tokio::sync::oneshot,
 };
 
-#[cfg(any(feature = "napi-6", all(feature = "napi-5", feature = "futures")))]
-use std::sync::Arc;
-
 const BOUNDARY: FailureBoundary = FailureBoundary {
     both: "A panic and exception occurred while resolving a `neon::types::Deferred`",
     exception: "An exception occurred while resolving a `neon::types::Deferred`",
@@ -287,7 +290,7 @@ impl Object for JsPromise {}
 pub struct Deferred {
     internal: Option<NodeApiDeferred>,
     #[cfg(feature = "napi-6")]
-    drop_queue: Arc<ThreadsafeFunction<DropData>>,
+    drop_queue: Arc<DropQueue>,
 }
 
 impl Deferred {
@@ -427,11 +430,160 @@ impl Drop for Deferred {
     fn drop(&mut self) {
         // If `None`, the `Deferred` has already been settled
         if let Some(internal) = self.internal.take() {
-            let _ = self.drop_queue.call(DropData::Deferred(internal), None);
+            self.drop_queue.push(DropData::Deferred(internal));
+        }
+    }
+}
+
+#[cfg(feature = "napi-4")]
+type BatchComplete = Box<dyn for<'cx> FnOnce(&mut Cx<'cx>) -> JsResult<'cx, JsValue> + Send>;
+
+/// A queue that settles [`Deferred`]s on the JavaScript main thread in
+/// coalesced batches.
+///
+/// Each [`Deferred::settle_with`] schedules its own event-loop callback, so a
+/// burst of settlements from a worker thread pays a loop wakeup, a native
+/// frame, and a handle scope per promise. A `DeferredBatch` instead appends
+/// settlements to a shared queue; the settlement that finds no callback in
+/// flight schedules one, and that single callback settles every promise
+/// queued by the time the event loop runs it, creating all of the settlement
+/// values inside one native frame and handle scope.
+///
+/// A `DeferredBatch` may be cloned and used from any thread. Settlements
+/// queued from a single thread are performed in the order they were queued.
+///
+/// As with [`Deferred::settle_with`], a callback that throws rejects its
+/// promise with the exception; one failed settlement does not affect the
+/// others in the batch.
+///
+/// # Example
+///
+/// ```
+/// # use neon::prelude::*;
+/// # use neon::types::DeferredBatch;
+/// # fn start_job(mut cx: FunctionContext) -> JsResult<JsArray> {
+/// let batch = DeferredBatch::new(&mut cx);
+/// let promises = cx.empty_array();
+/// let mut jobs = Vec::new();
+///
+/// for i in 0..1024u32 {
+///     let (deferred, promise) = cx.promise();
+///
+///     promises.set(&mut cx, i, promise)?;
+///     jobs.push(deferred);
+/// }
+///
+/// std::thread::spawn(move || {
+///     for (i, deferred) in jobs.into_iter().enumerate() {
+///         // All of these cross to the JavaScript thread together.
+///         batch.settle_with(deferred, move |cx| Ok(cx.number(i as f64)));
+///     }
+/// });
+///
+/// Ok(promises)
+/// # }
+/// ```
+#[cfg(feature = "napi-4")]
+#[cfg_attr(docsrs, doc(cfg(feature = "napi-4")))]
+pub struct DeferredBatch {
+    state: Arc<BatchSettleState>,
+}
+
+#[cfg(feature = "napi-4")]
+impl DeferredBatch {
+    /// Creates a batch that settles promises on the event loop of the calling
+    /// thread.
+    pub fn new<'a, C: Context<'a>>(cx: &mut C) -> Self {
+        Self {
+            state: Arc::new(BatchSettleState {
+                channel: cx.channel(),
+                queue: Mutex::new(Vec::new()),
+                scheduled: AtomicBool::new(false),
+            }),
+        }
+    }
+
+    /// Queues a settlement for `deferred`; `complete` runs on the JavaScript
+    /// main thread, alongside every other settlement coalesced into the same
+    /// batch.
+    ///
+    /// Unlike [`Deferred::settle_with`], the callback borrows the context
+    /// because a single context serves the whole batch.
+    pub fn settle_with<V, F>(&self, deferred: Deferred, complete: F)
+    where
+        V: Value,
+        F: for<'cx> FnOnce(&mut Cx<'cx>) -> JsResult<'cx, V> + Send + 'static,
+    {
+        let complete: BatchComplete = Box::new(move |cx| complete(cx).map(|value| value.upcast()));
+
+        self.state.queue.lock().unwrap().push((deferred, complete));
+
+        // The settlement that finds no drain scheduled schedules one; see
+        // `BatchedChannel` for the ordering argument.
+        if !self.state.scheduled.swap(true, Ordering::AcqRel) {
+            let state = Arc::clone(&self.state);
+
+            // Sending only fails if the environment has shutdown; queued
+            // `Deferred`s are then rejected by their `Drop` implementations.
+            let _ = self
+                .state
+                .channel
+                .try_send(move |cx| Self::drain(&state, cx));
+        }
+    }
+
+    // Settles every queued promise inside the single native frame and handle
+    // scope of one event-loop callback
+    fn drain(state: &BatchSettleState, mut cx: Cx) -> crate::result::NeonResult<()> {
+        // Clear the flag _before_ draining, so a settlement queued after the
+        // drain below schedules a fresh callback instead of being stranded
+        state.scheduled.store(false, Ordering::Release);
+
+        let batch = mem::take(&mut *state.queue.lock().unwrap());
+
+        for (deferred, complete) in batch {
+            let env = cx.env().to_raw();
+
+            unsafe {
+                BOUNDARY.catch_failure(env, Some(deferred.into_inner()), |_| {
+                    match complete(&mut cx) {
+                        Ok(value) => value.to_local(),
+                        Err(_) => ptr::null_mut(),
+                    }
+                });
+            }
+        }
+
+        Ok(())
+    }
+}
+
+#[cfg(feature = "napi-4")]
+impl Clone for DeferredBatch {
+    /// Returns a clone that appends settlements to the same shared queue.
+    fn clone(&self) -> Self {
+        Self {
+            state: Arc::clone(&self.state),
         }
     }
 }
 
+#[cfg(feature = "napi-4")]
+impl fmt::Debug for DeferredBatch {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        f.write_str("DeferredBatch")
+    }
+}
+
+#[cfg(feature = "napi-4")]
+struct BatchSettleState {
+    // The channel is only used as a wakeup; settlements travel through
+    // `queue` so that an arbitrary number of them share one invocation.
+    channel: Channel,
+    queue: Mutex<Vec<(Deferred, BatchComplete)>>,
+    scheduled: AtomicBool,
+}
+
 #[cfg(all(feature = "napi-5", feature = "futures"))]
 #[cfg_attr(docsrs, doc(cfg(all(feature = "napi-5", feature = "futures"))))]
 /// A type of JavaScript
@@ -21,4 +21,17 @@ describe("JsArray", function () {
   it("returns undefined when accessing outside JsArray bounds", function () {
     assert.strictEqual(addon.read_js_array([]), undefined);
   });
+
+  it("return a JsArray built in bulk from a slice", function () {
+    assert.deepEqual([1, 2.5, -3], addon.return_js_array_from_slice());
+  });
+
+  it("return a JsArray built in bulk from an iterator", function () {
+    assert.deepEqual([0, 1, 2, 3], addon.return_js_array_from_iter());
+  });
+
+  it("can read numbers from a JsArray in bulk", function () {
+    assert.strictEqual(addon.sum_js_array_numbers([1, 2, 3.5]), 6.5);
+    assert.isNaN(addon.sum_js_array_numbers([1, "not a number"]));
+  });
 });
@@ -34,6 +34,24 @@ describe("errors", function () {
     assert.throws(() => addon.throw_error(msg), msg);
   });
 
+  it("should throw the same pre-materialized error from a template", function () {
+    const first = (() => {
+      try {
+        addon.throw_template_error();
+      } catch (err) {
+        return err;
+      }
+    })();
+
+    assert.instanceOf(first, TypeError);
+    assert.strictEqual(first.message, "invalid input");
+    assert.isUndefined(first.stack);
+
+    // The template roots a single error object and reuses it
+    assert.strictEqual(addon.create_template_error(), first);
+    assert.throws(() => addon.throw_template_error(), "invalid input");
+  });
+
   it("should be able to stringify a downcast error", function () {
     let msg = addon.downcast_error();
     assert.strictEqual(msg, "failed to downcast string to number");
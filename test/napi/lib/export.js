@@ -28,6 +28,23 @@ function functions() {
   it("add - sync", () => {
     assert.strictEqual(addon.simpleAdd(1, 2), 3);
     assert.strictEqual(addon.renamedAdd(1, 2), 3);
+    assert.strictEqual(addon.fastAdd(1, 2), 3);
+  });
+
+  it("add - lazy", () => {
+    const descriptor = Object.getOwnPropertyDescriptor(addon, "lazyAdd");
+
+    // Not materialized until first access
+    assert.strictEqual(typeof descriptor.get, "function");
+
+    assert.strictEqual(addon.lazyAdd(1, 2), 3);
+
+    // The first access replaced the accessor with the function
+    const cached = Object.getOwnPropertyDescriptor(addon, "lazyAdd");
+
+    assert.strictEqual(typeof cached.value, "function");
+    assert.strictEqual(addon.lazyAdd, cached.value);
+    assert.strictEqual(addon.lazyAdd(3, 4), 7);
   });
 
   it("add - task", async () => {
@@ -75,6 +75,54 @@ describe("Extractors", () => {
     assert.strictEqual(addon.extract_json_sum([8, 16, 18]), 42);
   });
 
+  it("Direct", () => {
+    assert.strictEqual(addon.extract_direct_sum([1, 2, 3, 4]), 10);
+    assert.strictEqual(addon.extract_direct_sum([8, 16, 18]), 42);
+
+    assert.deepStrictEqual(
+      addon.directRoundtrip([
+        ["a", 1],
+        ["b", null],
+      ]),
+      { a: 1, b: null }
+    );
+
+    assert.strictEqual(addon.directIntSum([1, 2, 3], -6), 0);
+    assert.strictEqual(addon.directIntSum([8, 16, 18], 0), 42);
+  });
+
+  it("Derived structs", () => {
+    assert.strictEqual(
+      addon.extractPoint({ x: 1, y: 2, label: "origin-ish" }),
+      "origin-ish (1, 2)"
+    );
+    assert.strictEqual(addon.extractPoint({ x: 1, y: 2 }), "point (1, 2)");
+
+    assert.deepStrictEqual(addon.createPoint(3, 4, "p"), {
+      x: 3,
+      y: 4,
+      label: "p",
+    });
+
+    assert.throws(
+      () => addon.extractPoint(42),
+      (err) => {
+        assert.match(err.message, /expected object/);
+
+        return true;
+      }
+    );
+
+    assert.throws(
+      () => addon.extractPoint({ x: 1, y: "nope" }),
+      (err) => {
+        assert.match(err.message, /expected number/);
+
+        return true;
+      }
+    );
+  });
+
   it("Either", () => {
     assert.strictEqual(addon.extractEither("hello"), "String: hello");
     assert.strictEqual(addon.extractEither(42), "Number: 42");
@@ -70,6 +70,15 @@ describe("JsFunction", function () {
     );
   });
 
+  it("call a JsFunction repeatedly with a PreparedCall", function () {
+    assert.equal(
+      addon.call_js_function_with_prepared_call(function (x) {
+        return x + 1;
+      }),
+      10
+    );
+  });
+
   it("call parseInt with .bind().apply()", function () {
     assert.equal(addon.call_parse_int_with_bind(), 42);
   });
@@ -276,6 +285,10 @@ describe("JsFunction", function () {
     assert.equal(addon.recompute_scoped(o), o);
   });
 
+  it("executes batches in a handle arena", function () {
+    assert.equal(addon.arena_sum(), 99);
+  });
+
   it("catches an exception with cx.try_catch", function () {
     var error = new Error("Something bad happened");
     assert.equal(addon.throw_and_catch(error), error);
@@ -39,6 +39,20 @@ describe("Futures", () => {
     });
   });
 
+  describe("LocalExecutor", () => {
+    it("polls spawned futures on the event loop thread", async () => {
+      const sum = await addon.local_executor_add(20, 22);
+
+      assert.strictEqual(sum, 42);
+    });
+
+    it("resumes a JsFuture await on the event loop thread", async () => {
+      const n = await addon.local_executor_await_future(async () => 41);
+
+      assert.strictEqual(n, 42);
+    });
+  });
+
   describe("JsFuture", () => {
     it("should be able to convert a promise to a future", async () => {
       const nums = new Float64Array([1, 2, 3, 4]);
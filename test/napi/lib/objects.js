@@ -139,6 +139,34 @@ describe("JsObject", function () {
     assert.strictEqual(obj.number, 42);
   });
 
+  it("accesses object properties with an interned key", function () {
+    const obj = { number: 3.141593 };
+
+    // Repeat to exercise both the cold and cached paths of the key.
+    assert.strictEqual(addon.get_property_with_interned_key(obj), 3.141593);
+    assert.strictEqual(addon.get_property_with_interned_key(obj), 3.141593);
+
+    addon.set_property_with_interned_key(obj);
+
+    assert.strictEqual(obj.number, 42);
+  });
+
+  it("gets multiple properties with .props()", function () {
+    const obj = { number: 3.141593, string: "hello node" };
+
+    assert.deepEqual(addon.get_all_properties_with_props(obj), [
+      3.141593,
+      "hello node",
+    ]);
+  });
+
+  it("sets multiple properties with .props()", function () {
+    assert.deepEqual(addon.set_many_properties_with_props(), {
+      number: 9000,
+      string: "hello node",
+    });
+  });
+
   it("calls a method with .prop()", function () {
     const obj = {
       name: "Diana Prince",
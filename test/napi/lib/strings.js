@@ -9,6 +9,12 @@ describe("JsString", function () {
     const decoder = new TextDecoder("utf-16");
     assert.equal(decoder.decode(addon.return_js_string_utf16()), "hello 🥹");
   });
+  it("should return an external JsString built in Rust", function () {
+    assert.equal(addon.return_external_js_string(), "hello node");
+  });
+  it("should return an external non-ASCII JsString built in Rust", function () {
+    assert.equal(addon.return_external_js_string_utf16(), "hello 🥹");
+  });
   describe("encoding", function () {
     it("should return the UTF-8 string length", function () {
       assert.equal(addon.return_length_utf8("hello 🥹"), 10);
@@ -17,6 +23,16 @@ describe("JsString", function () {
       assert.equal(addon.return_length_utf16("hello 🥹"), 8);
     });
   });
+  describe("encoding", function () {
+    it("should extract a string into a reused buffer", function () {
+      assert.equal(addon.extract_js_string_into_buffer(""), "");
+      assert.equal(addon.extract_js_string_into_buffer("hi"), "hi");
+      assert.equal(
+        addon.extract_js_string_into_buffer("hello 🥹"),
+        "hello 🥹"
+      );
+    });
+  });
   describe("run_as_script", function () {
     it("should return the evaluated value", function () {
       assert.equal(addon.run_string_as_script("6 * 7"), 42);
@@ -48,6 +48,41 @@ const assert = require("chai").assert;
     });
   });
 
+  it("should be able to coalesce callbacks on a batched channel", function (cb) {
+    const n = 64;
+    let next = 0;
+
+    addon.batched_threaded_callback(n, function (x) {
+      // Batched sends drain in order, unlike the multi-threaded test above
+      if (x !== next) {
+        cb(new Error(`Unexpected callback value: ${x}`));
+      }
+
+      next += 1;
+
+      if (next === n) {
+        cb();
+      }
+    });
+  });
+
+  it("should report queue-full on a bounded channel", function (cb) {
+    const n = 6;
+    let delivered = 0;
+
+    const [capacity, sent, full] = addon.bounded_channel_full(n, function (x) {
+      delivered += 1;
+
+      if (delivered === sent) {
+        cb();
+      }
+    });
+
+    assert.strictEqual(capacity, 4);
+    assert.strictEqual(sent, 4);
+    assert.strictEqual(full, 2);
+  });
+
   it("should be able to use an async greeter", function (cb) {
     const greeter = addon.greeter_new("Hello, World!", function (greeting) {
       if (greeting === "Hello, World!") {
@@ -123,6 +158,16 @@ const assert = require("chai").assert;
     assert.strictEqual(expected, actual);
   });
 
+  it("should be able to sum numbers on a neon task pool", async function () {
+    const nums = new Float64Array(
+      [...new Array(10000)].map(() => Math.random())
+    );
+    const expected = nums.reduce((y, x) => y + x, 0);
+    const actual = await addon.sum_on_task_pool(nums);
+
+    assert.strictEqual(expected, actual);
+  });
+
   it("should be able to resolve a promise manually", async function () {
     const nums = new Float64Array(
       [...new Array(10000)].map(() => Math.random())
@@ -143,6 +188,62 @@ const assert = require("chai").assert;
     assert.strictEqual(expected, actual);
   });
 
+  it("should settle a burst of promises through a batch", async function () {
+    const n = 100;
+    const promises = addon.batch_settle_promises(n);
+
+    assert.strictEqual(promises.length, n);
+
+    const results = await Promise.allSettled(promises);
+
+    for (let i = 0; i < n; i++) {
+      if (i === 1) {
+        assert.strictEqual(results[i].status, "rejected");
+        assert.strictEqual(results[i].reason.message, "rejected from batch");
+      } else {
+        assert.strictEqual(results[i].status, "fulfilled");
+        assert.strictEqual(results[i].value, i);
+      }
+    }
+  });
+
+  it("should stream chunks from a producer thread", async function () {
+    const n = 32;
+    const chunkSize = 1024;
+    const stream = addon.stream_byte_chunks(n, chunkSize);
+
+    let i = 0;
+
+    for await (const chunk of stream) {
+      assert.instanceOf(chunk, Buffer);
+      assert.strictEqual(chunk.length, chunkSize);
+      assert.ok(chunk.every((byte) => byte === i % 256));
+      i++;
+    }
+
+    assert.strictEqual(i, n);
+  });
+
+  it("should close the stream when the consumer stops early", async function () {
+    const stream = addon.stream_byte_chunks(32, 16);
+
+    let i = 0;
+
+    // Breaking out of the loop invokes `return()`, closing the stream; the
+    // producer thread observes the closure and stops writing
+    for await (const chunk of stream) {
+      if (++i === 3) {
+        break;
+      }
+    }
+
+    assert.strictEqual(i, 3);
+
+    const result = await stream.next();
+
+    assert.strictEqual(result.done, true);
+  });
+
   it("should reject promise if leaked", async function () {
     try {
       await addon.leak_promise();
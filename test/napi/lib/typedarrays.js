@@ -257,6 +257,18 @@ describe("Typed arrays", function () {
     }
   });
 
+  it("converts numeric columns into typed arrays", function () {
+    var f64 = addon.widen_i32_column(new Int32Array([-3, 0, 1 << 30]));
+    assert.instanceOf(f64, Float64Array);
+    assert.deepEqual([...f64], [-3, 0, 1 << 30]);
+
+    var f32 = addon.normalize_u8_column(new Uint8Array([0, 51, 255]));
+    assert.instanceOf(f32, Float32Array);
+    assert.strictEqual(f32[0], 0);
+    assert.closeTo(f32[1], 0.2, 1e-6);
+    assert.strictEqual(f32[2], 1);
+  });
+
   it("gets correct typed array info", function () {
     var buf = new ArrayBuffer(128);
 
@@ -428,6 +440,61 @@ describe("Typed arrays", function () {
     }
   });
 
+  it("memory-maps a file as an ArrayBuffer", function () {
+    if (process.platform === "win32") {
+      this.skip();
+    }
+
+    const fs = require("fs");
+    const os = require("os");
+    const path = require("path");
+
+    const file = path.join(os.tmpdir(), `neon-mmap-${process.pid}.bin`);
+    fs.writeFileSync(file, Buffer.from([0, 1, 2, 3, 4, 5, 6, 7]));
+
+    try {
+      // Whole file
+      const whole = addon.return_mmapped_array_buffer(file);
+      assert.strictEqual(whole.byteLength, 8);
+      assert.deepEqual([...new Uint8Array(whole)], [0, 1, 2, 3, 4, 5, 6, 7]);
+
+      // Sub-range, viewed through a typed array
+      const range = addon.return_mmapped_array_buffer(file, 2, 6);
+      assert.deepEqual([...new Uint8Array(range)], [2, 3, 4, 5]);
+
+      // Writes are copy-on-write and do not reach the file
+      new Uint8Array(whole)[0] = 42;
+      assert.strictEqual(fs.readFileSync(file)[0], 0);
+
+      // Out-of-bounds ranges throw
+      assert.throws(() => addon.return_mmapped_array_buffer(file, 4, 12));
+      assert.throws(() => addon.return_mmapped_array_buffer("/no/such/file"));
+    } finally {
+      fs.unlinkSync(file);
+    }
+  });
+
+  it("takes zero-filled buffers from a pool", function () {
+    const a = addon.return_pooled_buffer(100);
+    assert.instanceOf(a, Buffer);
+    assert.strictEqual(a.length, 100);
+    assert.isTrue(a.every((b) => b === 0));
+
+    a.fill(0xff);
+
+    // A second buffer is independent of the first and still zeroed
+    const b = addon.return_pooled_buffer(100);
+    assert.isTrue(b.every((b) => b === 0));
+    assert.isTrue(a.every((b) => b === 0xff));
+
+    // Requests too large for the pool's size classes still work
+    const c = addon.return_pooled_buffer(32 * 1024 * 1024);
+    assert.strictEqual(c.length, 32 * 1024 * 1024);
+
+    // Zero-length requests work
+    assert.strictEqual(addon.return_pooled_buffer(0).length, 0);
+  });
+
   it("zeroes the byteLength when an ArrayBuffer is detached", function () {
     var buf = new ArrayBuffer(16);
     assert.strictEqual(buf.byteLength, 16);
@@ -24,3 +24,18 @@ pub fn read_js_array(mut cx: FunctionContext) -> JsResult<JsValue> {
 
     Ok(first_element)
 }
+
+pub fn return_js_array_from_slice(mut cx: FunctionContext) -> JsResult<JsArray> {
+    JsArray::from_slice(&mut cx, &[1.0, 2.5, -3.0])
+}
+
+pub fn return_js_array_from_iter(mut cx: FunctionContext) -> JsResult<JsArray> {
+    JsArray::from_iter(&mut cx, 0..4)
+}
+
+pub fn sum_js_array_numbers(mut cx: FunctionContext) -> JsResult<JsNumber> {
+    let array: Handle<JsArray> = cx.argument(0)?;
+    let values = array.to_vec_numbers(&mut cx)?;
+
+    Ok(cx.number(values.into_iter().sum::<f64>()))
+}
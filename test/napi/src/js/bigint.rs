@@ -405,6 +405,36 @@ fn test_to_digits_le(cx: &mut FunctionContext) -> NeonResult<()> {
     Ok(())
 }
 
+fn test_u64_slice_roundtrip(cx: &mut FunctionContext) -> NeonResult<()> {
+    let ids = [0u64, 1, 42, u64::MAX];
+    let array = JsBigInt::from_u64_slice(cx, &ids)?;
+
+    strict_eq(
+        array.get::<JsBigInt, _, _>(cx, 3)?,
+        eval(cx, "18446744073709551615n")?,
+        cx,
+    )?;
+
+    assert_eq!(JsBigInt::to_u64_vec(cx, array)?, ids);
+
+    Ok(())
+}
+
+fn test_i64_slice_roundtrip(cx: &mut FunctionContext) -> NeonResult<()> {
+    let ids = [i64::MIN, -1, 0, 42, i64::MAX];
+    let array = JsBigInt::from_i64_slice(cx, &ids)?;
+
+    strict_eq(
+        array.get::<JsBigInt, _, _>(cx, 0)?,
+        eval(cx, "-9223372036854775808n")?,
+        cx,
+    )?;
+
+    assert_eq!(JsBigInt::to_i64_vec(cx, array)?, ids);
+
+    Ok(())
+}
+
 fn test_very_large_number(cx: &mut FunctionContext) -> NeonResult<()> {
     // 2048-bit prime generated with `crypto.generatePrimeSync(2048)`
     // Note: Unlike the rest of the tests, this number is big-endian
@@ -497,6 +527,8 @@ pub fn bigint_suite(mut cx: FunctionContext) -> JsResult<JsObject> {
     export(&mut cx, &o, test_to_u128)?;
     export(&mut cx, &o, test_to_i128)?;
     export(&mut cx, &o, test_to_digits_le)?;
+    export(&mut cx, &o, test_u64_slice_roundtrip)?;
+    export(&mut cx, &o, test_i64_slice_roundtrip)?;
     export(&mut cx, &o, test_very_large_number)?;
 
     // `Err` tests
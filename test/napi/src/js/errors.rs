@@ -1,4 +1,14 @@
-use neon::prelude::*;
+use neon::{prelude::*, types::ErrorTemplate};
+
+static INVALID_INPUT: ErrorTemplate = ErrorTemplate::type_error("invalid input").without_stack();
+
+pub fn throw_template_error(mut cx: FunctionContext) -> JsResult<JsUndefined> {
+    INVALID_INPUT.throw(&mut cx)
+}
+
+pub fn create_template_error(mut cx: FunctionContext) -> JsResult<JsError> {
+    INVALID_INPUT.create(&mut cx)
+}
 
 pub fn new_error(mut cx: FunctionContext) -> JsResult<JsError> {
     let msg = cx.argument::<JsString>(0)?.value(&mut cx);
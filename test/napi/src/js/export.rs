@@ -31,11 +31,21 @@ fn rs_renamed_add(a: f64, b: f64) -> f64 {
     simple_add(a, b)
 }
 
+#[neon::export(unwind = "abort")]
+fn fast_add(a: f64, b: f64) -> f64 {
+    simple_add(a, b)
+}
+
 #[neon::export(task)]
 fn add_task(a: f64, b: f64) -> f64 {
     simple_add(a, b)
 }
 
+#[neon::export(lazy)]
+fn lazy_add(a: f64, b: f64) -> f64 {
+    simple_add(a, b)
+}
+
 #[neon::export(task, name = "renamedAddTask")]
 fn rs_renamed_add_task(a: f64, b: f64) -> f64 {
     add_task(a, b)
@@ -132,6 +132,26 @@ pub fn extract_json_sum(mut cx: FunctionContext) -> JsResult<JsNumber> {
     Ok(cx.number(nums.into_iter().sum::<f64>()))
 }
 
+pub fn extract_direct_sum(mut cx: FunctionContext) -> JsResult<JsNumber> {
+    let Direct::<Vec<f64>>(nums) = cx.args()?;
+
+    Ok(cx.number(nums.into_iter().sum::<f64>()))
+}
+
+#[neon::export]
+// Direct (de)serialization round-trips nested data without a JSON string
+pub fn direct_roundtrip(
+    Direct(pairs): Direct<Vec<(String, Option<f64>)>>,
+) -> Direct<std::collections::HashMap<String, Option<f64>>> {
+    Direct(pairs.into_iter().collect())
+}
+
+#[neon::export]
+// Integral numbers extract into integer-typed targets
+pub fn direct_int_sum(Direct(nums): Direct<Vec<u32>>, Direct(offset): Direct<i64>) -> Direct<i64> {
+    Direct(nums.into_iter().map(i64::from).sum::<i64>() + offset)
+}
+
 pub fn extract_single_add_one(mut cx: FunctionContext) -> JsResult<JsNumber> {
     let n: f64 = cx.args()?;
 
@@ -158,3 +178,30 @@ pub fn buffer_concat(mut a: Vec<u8>, Uint8Array(b): Uint8Array<Vec<u8>>) -> Arra
 pub fn string_to_buf(s: String) -> Uint8Array<String> {
     Uint8Array(s)
 }
+
+#[derive(TryFromJs, TryIntoJs)]
+pub struct Point {
+    x: f64,
+    y: f64,
+    label: Option<String>,
+}
+
+#[neon::export]
+// Structs with derived extractors convert in both directions
+pub fn extract_point(point: Point) -> String {
+    format!(
+        "{} ({}, {})",
+        point.label.as_deref().unwrap_or("point"),
+        point.x,
+        point.y
+    )
+}
+
+#[neon::export]
+pub fn create_point(x: f64, y: f64, label: String) -> Point {
+    Point {
+        x,
+        y,
+        label: Some(label),
+    }
+}
@@ -1,4 +1,4 @@
-use neon::{prelude::*, types::extract::With};
+use neon::{prelude::*, types::extract::With, types::function::PreparedCall};
 
 fn add1(mut cx: FunctionContext) -> JsResult<JsNumber> {
     let x = cx.argument::<JsNumber>(0)?.value(&mut cx);
@@ -55,6 +55,22 @@ pub fn call_js_function_with_bind_and_args_and_with(mut cx: FunctionContext) ->
     Ok(cx.number(n))
 }
 
+pub fn call_js_function_with_prepared_call(mut cx: FunctionContext) -> JsResult<JsNumber> {
+    let f = cx.argument::<JsFunction>(0)?.root(&mut cx);
+    let mut call = PreparedCall::new(f, None);
+    let mut sum = 0.0;
+
+    for i in 0..4 {
+        sum += call.bind(&mut cx).arg(i as f64)?.call::<f64>()?;
+    }
+
+    let (f, _) = call.into_parts();
+
+    f.drop(&mut cx);
+
+    Ok(cx.number(sum))
+}
+
 pub fn call_parse_int_with_bind(mut cx: FunctionContext) -> JsResult<JsNumber> {
     let parse_int: Handle<JsFunction> = cx.global("parseInt")?;
     let x: f64 = parse_int.bind(&mut cx).arg("41")?.call()?;
@@ -261,6 +277,29 @@ pub fn compute_scoped(mut cx: FunctionContext) -> JsResult<JsNumber> {
     Ok(i)
 }
 
+pub fn arena_sum(mut cx: FunctionContext) -> JsResult<JsNumber> {
+    let mut i = 0;
+
+    let escaped = cx.with_arena(|arena| {
+        for chunk in (1..100).collect::<Vec<i32>>().chunks(10) {
+            for _ in chunk {
+                arena.execute(|mut cx| {
+                    let n = cx.number(1);
+                    i += n.value(&mut cx) as i32;
+                });
+            }
+
+            // Frees each chunk's temporaries in bulk
+            arena.reset();
+        }
+
+        arena.compute(|mut cx| Ok(cx.number(i)))
+    })?;
+
+    // The escaped handle remains valid after the arena is gone
+    Ok(escaped)
+}
+
 // Simple identity function to verify that a handle can be moved to `compute_scoped`
 // closure and re-escaped.
 pub fn recompute_scoped(mut cx: FunctionContext) -> JsResult<JsValue> {
@@ -151,3 +151,94 @@ async fn await_callback(ch: Channel, cb: Root<JsFunction>) -> Result<Root<JsObje
 
     Ok(res)
 }
+
+// Accepts a function that returns a `Promise<number>`; resolves with the
+// number plus one, computed by a future spawned on a `LocalExecutor`.
+// Purpose: Test that a `JsFuture` wakeup on the event loop thread resumes the
+// future inline rather than hopping through the threadsafe function
+pub fn local_executor_await_future(mut cx: FunctionContext) -> JsResult<JsPromise> {
+    use neon::{LocalExecutor, Runtime};
+
+    let fut = cx
+        .argument::<JsFunction>(0)?
+        .call_with(&cx)
+        .apply::<JsPromise, _>(&mut cx)?
+        .to_future(&mut cx, |mut cx, n| {
+            let n = n
+                .or_throw(&mut cx)?
+                .downcast_or_throw::<JsNumber, _>(&mut cx)?
+                .value(&mut cx);
+
+            Ok(n)
+        })?;
+
+    let executor = LocalExecutor::new(&mut cx);
+    let channel = cx.channel();
+    let (deferred, promise) = cx.promise();
+    let main_thread = std::thread::current().id();
+
+    executor.spawn(Box::pin(async move {
+        let result = fut.await.map(|n| n + 1.0);
+        let resumed_on = std::thread::current().id();
+
+        deferred.settle_with(&channel, move |mut cx| {
+            if resumed_on != main_thread {
+                cx.throw_error("future was not resumed on the event loop thread")?;
+            }
+
+            let result = result.or_throw(&mut cx)?;
+
+            Ok(cx.number(result))
+        });
+    }));
+
+    Ok(promise)
+}
+
+// Resolves with a number computed by a future spawned on a `LocalExecutor`.
+// Purpose: Test that futures are polled on the event loop thread
+pub fn local_executor_add(mut cx: FunctionContext) -> JsResult<JsPromise> {
+    use neon::{LocalExecutor, Runtime};
+
+    let x = cx.argument::<JsNumber>(0)?.value(&mut cx);
+    let y = cx.argument::<JsNumber>(1)?.value(&mut cx);
+    let executor = LocalExecutor::new(&mut cx);
+    let channel = cx.channel();
+    let (deferred, promise) = cx.promise();
+    let main_thread = std::thread::current().id();
+
+    // Resolves `Pending` once so the continuation runs from a wakeup
+    struct YieldOnce(bool);
+
+    impl Future for YieldOnce {
+        type Output = ();
+
+        fn poll(
+            mut self: std::pin::Pin<&mut Self>,
+            cx: &mut std::task::Context,
+        ) -> std::task::Poll<()> {
+            if std::mem::replace(&mut self.0, true) {
+                std::task::Poll::Ready(())
+            } else {
+                cx.waker().wake_by_ref();
+                std::task::Poll::Pending
+            }
+        }
+    }
+
+    executor.spawn(Box::pin(async move {
+        YieldOnce(false).await;
+
+        let polled_on = std::thread::current().id();
+
+        deferred.settle_with(&channel, move |mut cx| {
+            if polled_on != main_thread {
+                cx.throw_error("future was not polled on the event loop thread")?;
+            }
+
+            Ok(cx.number(x + y))
+        });
+    }));
+
+    Ok(promise)
+}
@@ -1,6 +1,6 @@
 use std::borrow::Cow;
 
-use neon::{prelude::*, types::buffer::TypedArray};
+use neon::{object::Key, prelude::*, types::buffer::TypedArray};
 
 pub fn return_js_global_object(mut cx: FunctionContext) -> JsResult<JsObject> {
     Ok(cx.global_object())
@@ -108,6 +108,36 @@ pub fn set_property_with_prop(mut cx: FunctionContext) -> JsResult<JsUndefined>
     Ok(cx.undefined())
 }
 
+pub fn get_all_properties_with_props(mut cx: FunctionContext) -> JsResult<JsArray> {
+    let obj: Handle<JsObject> = cx.argument::<JsObject>(0)?;
+    let (n, s): (f64, String) = obj.props(&mut cx).get_all(("number", "string"))?;
+    let result = cx.empty_array();
+    result.prop(&mut cx, 0).set(n)?;
+    result.prop(&mut cx, 1).set(s)?;
+    Ok(result)
+}
+
+pub fn set_many_properties_with_props(mut cx: FunctionContext) -> JsResult<JsObject> {
+    let obj = cx.empty_object();
+    obj.props(&mut cx)
+        .set_many((("number", 9000), ("string", "hello node")))?;
+    Ok(obj)
+}
+
+static NUMBER_KEY: Key = Key::new("number");
+
+pub fn get_property_with_interned_key(mut cx: FunctionContext) -> JsResult<JsNumber> {
+    let obj: Handle<JsObject> = cx.argument::<JsObject>(0)?;
+    let n: f64 = obj.prop(&mut cx, &NUMBER_KEY).get()?;
+    Ok(cx.number(n))
+}
+
+pub fn set_property_with_interned_key(mut cx: FunctionContext) -> JsResult<JsUndefined> {
+    let obj: Handle<JsObject> = cx.argument::<JsObject>(0)?;
+    obj.prop(&mut cx, &NUMBER_KEY).set(42)?;
+    Ok(cx.undefined())
+}
+
 pub fn call_methods_with_prop(mut cx: FunctionContext) -> JsResult<JsString> {
     let obj: Handle<JsObject> = cx.argument::<JsObject>(0)?;
     obj.prop(&mut cx, "setName")
@@ -9,6 +9,14 @@ pub fn return_js_string_utf16(mut cx: FunctionContext) -> JsResult<JsTypedArray<
     JsTypedArray::from_slice(&mut cx, &raw)
 }
 
+pub fn return_external_js_string(mut cx: FunctionContext) -> JsResult<JsString> {
+    Ok(JsString::external(&mut cx, "hello node"))
+}
+
+pub fn return_external_js_string_utf16(mut cx: FunctionContext) -> JsResult<JsString> {
+    Ok(JsString::external(&mut cx, "hello 🥹"))
+}
+
 pub fn return_length_utf8(mut cx: FunctionContext) -> JsResult<JsNumber> {
     let value = cx.argument::<JsString>(0)?.value(&mut cx);
     Ok(cx.number(value.len() as f64))
@@ -19,6 +27,33 @@ pub fn return_length_utf16(mut cx: FunctionContext) -> JsResult<JsNumber> {
     Ok(cx.number(value.len() as f64))
 }
 
+pub fn extract_js_string_into_buffer(mut cx: FunctionContext) -> JsResult<JsString> {
+    let s = cx.argument::<JsString>(0)?;
+
+    // Start with a small buffer so the copy exercises the growth fallback,
+    // then extract a second time through the warm fast path.
+    let mut buf = String::with_capacity(4);
+    s.value_into(&mut cx, &mut buf);
+    let len = s.value_into(&mut cx, &mut buf);
+    assert_eq!(len, buf.len());
+
+    let mut slice = [0u8; 64];
+    if let Some(n) = s.value_to_slice(&mut cx, &mut slice) {
+        assert_eq!(&slice[..n], buf.as_bytes());
+    }
+
+    // A buffer that cuts into a trailing multi-byte sequence must not be
+    // mistaken for a complete copy
+    let emoji = cx.string("🥲🥲");
+    let mut tight = String::with_capacity(6);
+
+    assert_eq!(emoji.value_into(&mut cx, &mut tight), 8);
+    assert_eq!(tight, "🥲🥲");
+    assert_eq!(emoji.value_to_slice(&mut cx, &mut [0u8; 6]), None);
+
+    Ok(cx.string(buf))
+}
+
 pub fn run_string_as_script(mut cx: FunctionContext) -> JsResult<JsValue> {
     let string_script = cx.argument::<JsString>(0)?;
     eval(&mut cx, string_script)
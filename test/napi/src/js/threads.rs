@@ -1,8 +1,9 @@
 use std::{cell::RefCell, sync::Arc, time::Duration};
 
 use neon::{
+    event::{BatchedChannel, BoundedChannel, JsStream, TrySendError},
     prelude::*,
-    types::{buffer::TypedArray, extract::Error},
+    types::{buffer::TypedArray, extract::Error, DeferredBatch},
 };
 
 pub fn useless_root(mut cx: FunctionContext) -> JsResult<JsObject> {
@@ -49,6 +50,70 @@ pub fn multi_threaded_callback(mut cx: FunctionContext) -> JsResult<JsUndefined>
     Ok(cx.undefined())
 }
 
+pub fn batched_threaded_callback(mut cx: FunctionContext) -> JsResult<JsUndefined> {
+    let n = cx.argument::<JsNumber>(0)?.value(&mut cx);
+    let callback = cx.argument::<JsFunction>(1)?.root(&mut cx);
+    let callback = Arc::new(callback);
+    let channel = BatchedChannel::new(&mut cx);
+
+    std::thread::spawn(move || {
+        // All of these sends are expected to coalesce into a small number of
+        // event-loop wakeups; the suite only checks that each one runs.
+        for i in 0..(n as usize) {
+            let callback = Arc::clone(&callback);
+
+            channel.send(move |mut cx| {
+                callback
+                    .to_inner(&mut cx)
+                    .call_with(&cx)
+                    .arg(cx.number(i as f64))
+                    .exec(&mut cx)
+            });
+        }
+    });
+
+    Ok(cx.undefined())
+}
+
+pub fn bounded_channel_full(mut cx: FunctionContext) -> JsResult<JsArray> {
+    let n = cx.argument::<JsNumber>(0)?.value(&mut cx) as usize;
+    let callback = cx.argument::<JsFunction>(1)?.root(&mut cx);
+    let callback = Arc::new(callback);
+    let channel = BoundedChannel::with_capacity(&mut cx, 4);
+    let mut sent = 0u32;
+    let mut full = 0u32;
+
+    // The drain cannot run while this native frame is on the stack, so the
+    // channel fills deterministically after `capacity()` sends.
+    for i in 0..n {
+        let callback = Arc::clone(&callback);
+        let result = channel.try_send(move |mut cx| {
+            callback
+                .to_inner(&mut cx)
+                .call_with(&cx)
+                .arg(cx.number(i as f64))
+                .exec(&mut cx)
+        });
+
+        match result {
+            Ok(_) => sent += 1,
+            Err(TrySendError::Full) => full += 1,
+            Err(err) => panic!("unexpected send failure: {err}"),
+        }
+    }
+
+    let capacity = cx.number(channel.capacity() as f64);
+    let sent = cx.number(sent);
+    let full = cx.number(full);
+    let result = cx.empty_array();
+
+    result.set(&mut cx, 0, capacity)?;
+    result.set(&mut cx, 1, sent)?;
+    result.set(&mut cx, 2, full)?;
+
+    Ok(result)
+}
+
 type BoxedGreeter = JsBox<RefCell<AsyncGreeter>>;
 
 pub struct AsyncGreeter {
@@ -224,6 +289,22 @@ pub fn sum(mut cx: FunctionContext) -> JsResult<JsPromise> {
     Ok(promise)
 }
 
+pub fn sum_on_task_pool(mut cx: FunctionContext) -> JsResult<JsPromise> {
+    use neon::event::{TaskPool, TaskPriority};
+    use once_cell::sync::Lazy;
+
+    static POOL: Lazy<TaskPool> = Lazy::new(|| TaskPool::with_threads(2));
+
+    let nums = cx.argument::<JsTypedArray<f64>>(0)?.as_slice(&cx).to_vec();
+
+    let promise = cx
+        .task_on(&POOL, move || nums.into_iter().sum())
+        .priority(TaskPriority::High)
+        .promise(|mut cx, n: f64| Ok(cx.number(n)));
+
+    Ok(promise)
+}
+
 pub fn sum_manual_promise(mut cx: FunctionContext) -> JsResult<JsPromise> {
     let nums = cx.argument::<JsTypedArray<f64>>(0)?.as_slice(&cx).to_vec();
 
@@ -254,6 +335,60 @@ pub fn sum_rust_thread(mut cx: FunctionContext) -> JsResult<JsPromise> {
     Ok(promise)
 }
 
+pub fn batch_settle_promises(mut cx: FunctionContext) -> JsResult<JsArray> {
+    let n = cx.argument::<JsNumber>(0)?.value(&mut cx) as u32;
+
+    let batch = DeferredBatch::new(&mut cx);
+    let promises = cx.empty_array();
+    let mut jobs = Vec::with_capacity(n as usize);
+
+    for i in 0..n {
+        let (deferred, promise) = cx.promise();
+
+        promises.set(&mut cx, i, promise)?;
+        jobs.push(deferred);
+    }
+
+    std::thread::spawn(move || {
+        for (i, deferred) in jobs.into_iter().enumerate() {
+            if i == 1 {
+                // A throwing settlement rejects its own promise without
+                // disturbing the rest of the batch
+                batch.settle_with::<JsNumber, _>(deferred, move |cx| {
+                    cx.throw_error("rejected from batch")
+                });
+            } else {
+                batch.settle_with(deferred, move |cx| Ok(cx.number(i as f64)));
+            }
+        }
+    });
+
+    Ok(promises)
+}
+
+pub fn stream_byte_chunks(mut cx: FunctionContext) -> JsResult<JsObject> {
+    let n = cx.argument::<JsNumber>(0)?.value(&mut cx) as usize;
+    let chunk_size = cx.argument::<JsNumber>(1)?.value(&mut cx) as usize;
+
+    // A small capacity forces the producer to block on backpressure while the
+    // consumer catches up
+    let (mut stream, iterator) = JsStream::new(&mut cx, 4)?;
+
+    std::thread::spawn(move || {
+        let mut chunk = vec![0u8; chunk_size];
+
+        for i in 0..n {
+            chunk.fill(i as u8);
+
+            if stream.write(&chunk).is_err() {
+                return;
+            }
+        }
+    });
+
+    Ok(iterator)
+}
+
 pub fn leak_promise(mut cx: FunctionContext) -> JsResult<JsPromise> {
     let (_, promise) = cx.promise();
 
@@ -408,3 +408,44 @@ pub fn copy_buffer_with_borrow(mut cx: FunctionContext) -> JsResult<JsUndefined>
 
     Ok(cx.undefined())
 }
+
+#[cfg(unix)]
+pub fn return_mmapped_array_buffer(mut cx: FunctionContext) -> JsResult<JsArrayBuffer> {
+    let path = cx.argument::<JsString>(0)?.value(&mut cx);
+    let range = match (cx.argument_opt(1), cx.argument_opt(2)) {
+        (Some(start), Some(end)) => Some(
+            (start
+                .downcast_or_throw::<JsNumber, _>(&mut cx)?
+                .value(&mut cx) as u64)
+                ..(end
+                    .downcast_or_throw::<JsNumber, _>(&mut cx)?
+                    .value(&mut cx) as u64),
+        ),
+        _ => None,
+    };
+
+    JsArrayBuffer::mmap(&mut cx, path, range)
+}
+
+pub fn return_pooled_buffer(mut cx: FunctionContext) -> JsResult<JsBuffer> {
+    use neon::types::buffer::Pool;
+    use once_cell::sync::Lazy;
+
+    static POOL: Lazy<Pool> = Lazy::new(Pool::new);
+
+    let len = cx.argument::<JsNumber>(0)?.value(&mut cx) as usize;
+
+    Ok(POOL.take(&mut cx, len))
+}
+
+pub fn widen_i32_column(mut cx: FunctionContext) -> JsResult<JsTypedArray<f64>> {
+    let column = cx.argument::<JsTypedArray<i32>>(0)?.as_slice(&cx).to_vec();
+
+    JsTypedArray::from_column(&mut cx, &column)
+}
+
+pub fn normalize_u8_column(mut cx: FunctionContext) -> JsResult<JsTypedArray<f32>> {
+    let column = cx.argument::<JsTypedArray<u8>>(0)?.as_slice(&cx).to_vec();
+
+    JsTypedArray::from_column(&mut cx, &column)
+}
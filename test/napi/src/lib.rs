@@ -122,9 +122,18 @@ fn main(mut cx: ModuleContext) -> NeonResult<()> {
 
     cx.export_function("return_js_string", return_js_string)?;
     cx.export_function("return_js_string_utf16", return_js_string_utf16)?;
+    cx.export_function("return_external_js_string", return_external_js_string)?;
+    cx.export_function(
+        "return_external_js_string_utf16",
+        return_external_js_string_utf16,
+    )?;
     cx.export_function("return_length_utf8", return_length_utf8)?;
     cx.export_function("return_length_utf16", return_length_utf16)?;
     cx.export_function("run_string_as_script", run_string_as_script)?;
+    cx.export_function(
+        "extract_js_string_into_buffer",
+        extract_js_string_into_buffer,
+    )?;
 
     cx.export_function("return_js_number", return_js_number)?;
     cx.export_function("return_large_js_number", return_large_js_number)?;
@@ -155,6 +164,10 @@ fn main(mut cx: ModuleContext) -> NeonResult<()> {
         call_js_function_idiomatically,
     )?;
     cx.export_function("call_js_function_with_bind", call_js_function_with_bind)?;
+    cx.export_function(
+        "call_js_function_with_prepared_call",
+        call_js_function_with_prepared_call,
+    )?;
     cx.export_function(
         "call_js_function_with_bind_and_args_with",
         call_js_function_with_bind_and_args_with,
@@ -228,11 +241,15 @@ fn main(mut cx: ModuleContext) -> NeonResult<()> {
     cx.export_function("execute_scoped", execute_scoped)?;
     cx.export_function("compute_scoped", compute_scoped)?;
     cx.export_function("recompute_scoped", recompute_scoped)?;
+    cx.export_function("arena_sum", arena_sum)?;
 
     cx.export_function("return_js_array", return_js_array)?;
     cx.export_function("return_js_array_with_number", return_js_array_with_number)?;
     cx.export_function("return_js_array_with_string", return_js_array_with_string)?;
     cx.export_function("read_js_array", read_js_array)?;
+    cx.export_function("return_js_array_from_slice", return_js_array_from_slice)?;
+    cx.export_function("return_js_array_from_iter", return_js_array_from_iter)?;
+    cx.export_function("sum_js_array_numbers", sum_js_array_numbers)?;
 
     cx.export_function("to_string", to_string)?;
 
@@ -295,6 +312,8 @@ fn main(mut cx: ModuleContext) -> NeonResult<()> {
     )?;
     cx.export_function("return_new_int32array", return_new_int32array)?;
     cx.export_function("return_int32array_from_slice", return_int32array_from_slice)?;
+    cx.export_function("widen_i32_column", widen_i32_column)?;
+    cx.export_function("normalize_u8_column", normalize_u8_column)?;
     cx.export_function(
         "return_uint32array_from_arraybuffer_region",
         return_uint32array_from_arraybuffer_region,
@@ -313,12 +332,31 @@ fn main(mut cx: ModuleContext) -> NeonResult<()> {
     cx.export_function("write_buffer_with_borrow_mut", write_buffer_with_borrow_mut)?;
     cx.export_function("copy_buffer", copy_buffer)?;
     cx.export_function("copy_buffer_with_borrow", copy_buffer_with_borrow)?;
+    #[cfg(unix)]
+    cx.export_function("return_mmapped_array_buffer", return_mmapped_array_buffer)?;
+    cx.export_function("return_pooled_buffer", return_pooled_buffer)?;
     cx.export_function("byte_length", byte_length)?;
     cx.export_function("call_nullary_method", call_nullary_method)?;
     cx.export_function("call_unary_method", call_unary_method)?;
     cx.export_function("call_symbol_method", call_symbol_method)?;
     cx.export_function("get_property_with_prop", get_property_with_prop)?;
     cx.export_function("set_property_with_prop", set_property_with_prop)?;
+    cx.export_function(
+        "get_property_with_interned_key",
+        get_property_with_interned_key,
+    )?;
+    cx.export_function(
+        "set_property_with_interned_key",
+        set_property_with_interned_key,
+    )?;
+    cx.export_function(
+        "get_all_properties_with_props",
+        get_all_properties_with_props,
+    )?;
+    cx.export_function(
+        "set_many_properties_with_props",
+        set_many_properties_with_props,
+    )?;
     cx.export_function("call_methods_with_prop", call_methods_with_prop)?;
     cx.export_function("call_non_method_with_prop", call_non_method_with_prop)?;
 
@@ -350,6 +388,8 @@ fn main(mut cx: ModuleContext) -> NeonResult<()> {
     cx.export_function("new_range_error", new_range_error)?;
     cx.export_function("throw_error", throw_error)?;
     cx.export_function("downcast_error", downcast_error)?;
+    cx.export_function("throw_template_error", throw_template_error)?;
+    cx.export_function("create_template_error", create_template_error)?;
 
     cx.export_function("panic", panic)?;
     cx.export_function("panic_after_throw", panic_after_throw)?;
@@ -389,14 +429,19 @@ fn main(mut cx: ModuleContext) -> NeonResult<()> {
     cx.export_function("useless_root", useless_root)?;
     cx.export_function("thread_callback", thread_callback)?;
     cx.export_function("multi_threaded_callback", multi_threaded_callback)?;
+    cx.export_function("batched_threaded_callback", batched_threaded_callback)?;
+    cx.export_function("bounded_channel_full", bounded_channel_full)?;
     cx.export_function("greeter_new", greeter_new)?;
     cx.export_function("greeter_greet", greeter_greet)?;
     cx.export_function("leak_channel", leak_channel)?;
     cx.export_function("drop_global_queue", drop_global_queue)?;
     cx.export_function("channel_join", channel_join)?;
     cx.export_function("sum", sum)?;
+    cx.export_function("sum_on_task_pool", sum_on_task_pool)?;
     cx.export_function("sum_manual_promise", sum_manual_promise)?;
     cx.export_function("sum_rust_thread", sum_rust_thread)?;
+    cx.export_function("batch_settle_promises", batch_settle_promises)?;
+    cx.export_function("stream_byte_chunks", stream_byte_chunks)?;
     cx.export_function("leak_promise", leak_promise)?;
     cx.export_function("channel_panic", channel_panic)?;
     cx.export_function("channel_throw", channel_throw)?;
@@ -431,6 +476,11 @@ fn main(mut cx: ModuleContext) -> NeonResult<()> {
 
     // Futures
     cx.export_function("lazy_async_add", js::futures::lazy_async_add)?;
+    cx.export_function("local_executor_add", js::futures::local_executor_add)?;
+    cx.export_function(
+        "local_executor_await_future",
+        js::futures::local_executor_await_future,
+    )?;
     cx.export_function("lazy_async_sum", js::futures::lazy_async_sum)?;
 
     // JsBigInt test suite
@@ -440,6 +490,7 @@ fn main(mut cx: ModuleContext) -> NeonResult<()> {
     cx.export_function("extract_values", js::extract::extract_values)?;
     cx.export_function("extract_buffer_sum", js::extract::extract_buffer_sum)?;
     cx.export_function("extract_json_sum", js::extract::extract_json_sum)?;
+    cx.export_function("extract_direct_sum", js::extract::extract_direct_sum)?;
     cx.export_function(
         "extract_single_add_one",
         js::extract::extract_single_add_one,